@@ -17,8 +17,14 @@
 
 #include "iotjs.h"
 #include "iotjs_js.h"
-#include "iotjs_string_ext.h"
+#include "iotjs_tick.h"
+#include "iotjs_uv_pool.h"
 #include "jerryscript-ext/debugger.h"
+#include "modules/iotjs_module_buffer.h"
+#include "modules/iotjs_module_console.h"
+#if ENABLE_MODULE_HTTP_PARSER
+#include "modules/iotjs_module_http_parser.h"
+#endif
 #if ENABLE_MODULE_NAPI
 #include "internal/node_api_internal.h"
 #endif
@@ -263,6 +269,8 @@ static int iotjs_start(iotjs_environment_t* env) {
 
 void iotjs_end(iotjs_environment_t* env) {
   uv_loop_t* loop = iotjs_environment_loop(env);
+  // Release the queued callbacks and close their handles.
+  iotjs_tick_cleanup();
   // Close uv loop.
   uv_walk(loop, (uv_walk_cb)iotjs_uv_handle_close, NULL);
   uv_run(loop, UV_RUN_DEFAULT);
@@ -273,13 +281,31 @@ void iotjs_end(iotjs_environment_t* env) {
 
 
 void iotjs_terminate(iotjs_environment_t* env) {
+  // Write out the console output still queued in asynchronous mode.
+  iotjs_console_cleanup();
+  // Release the cached Buffer prototype.
+  iotjs_bufferwrap_prototype_cleanup();
+#if ENABLE_MODULE_HTTP_PARSER
+  // Release the interned HTTP header names.
+  iotjs_http_parser_release_header_names();
+#endif
   // Release builtin modules.
   iotjs_module_list_cleanup();
 #if ENABLE_MODULE_NAPI
   iotjs_cleanup_napi();
 #endif
+  // Release the property keys.
+  iotjs_release_jerry_magic_string();
   // Release JerryScript engine.
   jerry_cleanup();
+  // Release the storage cached for buffers, all of them are freed by now.
+  iotjs_bufferwrap_pool_cleanup();
+#if ENABLE_MODULE_HTTP_PARSER
+  // Release the wrappers kept for new HTTP parsers.
+  iotjs_http_parser_pool_cleanup();
+#endif
+  // Release the memory cached for uv handles and requests.
+  iotjs_uv_pool_cleanup();
 }
 
 
@@ -95,14 +95,12 @@ bool iotjs_jbuffer_as_string(jerry_value_t jval, iotjs_string_t* out_string) {
       return false;
     }
 
-    char* buffer = iotjs_buffer_allocate(size + 1);
+    *out_string = iotjs_string_create();
+    char* buffer = iotjs_string_reserve(out_string, size);
     size_t check =
         jerry_string_to_char_buffer(jval, (jerry_char_t*)buffer, size);
 
     IOTJS_ASSERT(check == size);
-
-    buffer[size] = '\0';
-    *out_string = iotjs_string_create_with_buffer(buffer, size);
     return true;
   }
 
@@ -114,10 +112,7 @@ bool iotjs_jbuffer_as_string(jerry_value_t jval, iotjs_string_t* out_string) {
 
   size_t size = buffer_wrap->length;
 
-  char* buffer = iotjs_buffer_allocate(size + 1);
-  memcpy(buffer, buffer_wrap->buffer, size);
-  buffer[size] = '\0';
-  *out_string = iotjs_string_create_with_buffer(buffer, size);
+  *out_string = iotjs_string_create_with_size(buffer_wrap->buffer, size);
   return true;
 }
 
@@ -213,23 +208,50 @@ void iotjs_free_tmp_buffer(iotjs_tmp_buffer_t* tmp_buffer) {
 }
 
 
+void iotjs_jval_as_stack_string(jerry_value_t jval,
+                                iotjs_stack_string_t* out_string) {
+  IOTJS_ASSERT(jerry_value_is_string(jval));
+
+  jerry_size_t size = jerry_get_utf8_string_size(jval);
+
+  if (size < sizeof(out_string->buffer)) {
+    out_string->data = out_string->buffer;
+  } else {
+    out_string->data = iotjs_buffer_allocate_uninitialized(size + 1);
+  }
+
+  jerry_char_t* buffer = (jerry_char_t*)out_string->data;
+  size_t check = jerry_string_to_utf8_char_buffer(jval, buffer, size);
+  IOTJS_ASSERT(check == size);
+
+  out_string->data[size] = '\0';
+  out_string->size = size;
+}
+
+
+void iotjs_free_stack_string(iotjs_stack_string_t* stack_string) {
+  if (stack_string->data != stack_string->buffer) {
+    iotjs_buffer_release(stack_string->data);
+  }
+  stack_string->data = NULL;
+  stack_string->size = 0;
+}
+
+
 iotjs_string_t iotjs_jval_as_string(jerry_value_t jval) {
   IOTJS_ASSERT(jerry_value_is_string(jval));
 
   jerry_size_t size = jerry_get_utf8_string_size(jval);
+  iotjs_string_t res = iotjs_string_create();
 
   if (size == 0)
-    return iotjs_string_create();
-
-  char* buffer = iotjs_buffer_allocate(size + 1);
-  jerry_char_t* jerry_buffer = (jerry_char_t*)(buffer);
+    return res;
 
-  size_t check = jerry_string_to_utf8_char_buffer(jval, jerry_buffer, size);
+  // Short strings are converted into the inline storage of the result.
+  jerry_char_t* buffer = (jerry_char_t*)iotjs_string_reserve(&res, size);
+  size_t check = jerry_string_to_utf8_char_buffer(jval, buffer, size);
 
   IOTJS_ASSERT(check == size);
-  buffer[size] = '\0';
-
-  iotjs_string_t res = iotjs_string_create_with_buffer(buffer, size);
 
   return res;
 }
@@ -272,16 +294,39 @@ void iotjs_jval_set_method(jerry_value_t jobj, const char* name,
 }
 
 
-void iotjs_jval_set_property_jval(jerry_value_t jobj, const char* name,
-                                  jerry_value_t value) {
+// Defines `name` as an accessor property, used where the native side keeps
+// its own reference to the assigned value.
+void iotjs_jval_set_accessor(jerry_value_t jobj, const char* name,
+                             jerry_external_handler_t getter,
+                             jerry_external_handler_t setter) {
   IOTJS_ASSERT(jerry_value_is_object(jobj));
 
-  jerry_value_t prop_name = jerry_create_string((const jerry_char_t*)(name));
-  jerry_value_t ret_val = jerry_set_property(jobj, prop_name, value);
-  jerry_release_value(prop_name);
+  jerry_property_descriptor_t prop_desc;
+  jerry_init_property_descriptor_fields(&prop_desc);
 
+  prop_desc.is_get_defined = true;
+  prop_desc.getter = jerry_create_external_function(getter);
+  prop_desc.is_set_defined = true;
+  prop_desc.setter = jerry_create_external_function(setter);
+  prop_desc.is_configurable_defined = true;
+  prop_desc.is_configurable = true;
+
+  jerry_value_t prop_name = jerry_create_string((const jerry_char_t*)(name));
+  jerry_value_t ret_val =
+      jerry_define_own_property(jobj, prop_name, &prop_desc);
   IOTJS_ASSERT(!jerry_value_is_error(ret_val));
+
   jerry_release_value(ret_val);
+  jerry_release_value(prop_name);
+  jerry_free_property_descriptor_fields(&prop_desc);
+}
+
+
+void iotjs_jval_set_property_jval(jerry_value_t jobj, const char* name,
+                                  jerry_value_t value) {
+  jerry_value_t prop_name = jerry_create_string((const jerry_char_t*)(name));
+  iotjs_jval_set_property_by_key(jobj, prop_name, value);
+  jerry_release_value(prop_name);
 }
 
 
@@ -326,12 +371,65 @@ void iotjs_jval_set_property_string_raw(jerry_value_t jobj, const char* name,
 
 
 jerry_value_t iotjs_jval_get_property(jerry_value_t jobj, const char* name) {
-  IOTJS_ASSERT(jerry_value_is_object(jobj));
-
   jerry_value_t prop_name = jerry_create_string((const jerry_char_t*)(name));
-  jerry_value_t res = jerry_get_property(jobj, prop_name);
+  jerry_value_t res = iotjs_jval_get_property_by_key(jobj, prop_name);
   jerry_release_value(prop_name);
 
+  return res;
+}
+
+
+// The `_by_key` variants take the property name as a string value, usually
+// one of the IOTJS_KEY() table, and do not create or release it.
+void iotjs_jval_set_property_by_key(jerry_value_t jobj, jerry_value_t key,
+                                    jerry_value_t value) {
+  IOTJS_ASSERT(jerry_value_is_object(jobj));
+
+  jerry_value_t ret_val = jerry_set_property(jobj, key, value);
+
+  IOTJS_ASSERT(!jerry_value_is_error(ret_val));
+  jerry_release_value(ret_val);
+}
+
+
+void iotjs_jval_set_property_boolean_by_key(jerry_value_t jobj,
+                                            jerry_value_t key, bool v) {
+  iotjs_jval_set_property_by_key(jobj, key, jerry_create_boolean(v));
+}
+
+
+void iotjs_jval_set_property_number_by_key(jerry_value_t jobj,
+                                           jerry_value_t key, double v) {
+  jerry_value_t jval = jerry_create_number(v);
+  iotjs_jval_set_property_by_key(jobj, key, jval);
+  jerry_release_value(jval);
+}
+
+
+void iotjs_jval_set_property_string_by_key(jerry_value_t jobj,
+                                           jerry_value_t key,
+                                           const iotjs_string_t* v) {
+  jerry_value_t jval = iotjs_jval_create_string(v);
+  iotjs_jval_set_property_by_key(jobj, key, jval);
+  jerry_release_value(jval);
+}
+
+
+void iotjs_jval_set_property_string_raw_by_key(jerry_value_t jobj,
+                                               jerry_value_t key,
+                                               const char* v) {
+  jerry_value_t jval = jerry_create_string((const jerry_char_t*)v);
+  iotjs_jval_set_property_by_key(jobj, key, jval);
+  jerry_release_value(jval);
+}
+
+
+jerry_value_t iotjs_jval_get_property_by_key(jerry_value_t jobj,
+                                             jerry_value_t key) {
+  IOTJS_ASSERT(jerry_value_is_object(jobj));
+
+  jerry_value_t res = jerry_get_property(jobj, key);
+
   if (jerry_value_is_error(res)) {
     jerry_release_value(res);
     return jerry_create_undefined();
@@ -54,9 +54,34 @@ void iotjs_jval_get_jproperty_as_tmp_buffer(jerry_value_t jobj,
                                             iotjs_tmp_buffer_t* out_buffer);
 void iotjs_free_tmp_buffer(iotjs_tmp_buffer_t* tmp_buffer);
 
+/* Zero terminated UTF-8 copies of string values for bindings which only use
+ * them during the call. Strings which fit into `buffer` are not allocated,
+ * so declare these on the stack. */
+
+#ifndef IOTJS_STACK_STRING_SIZE
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_STACK_STRING_SIZE 64
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_STACK_STRING_SIZE 256
+#endif /* __NUTTX__ || __TIZENRT__ */
+#endif /* IOTJS_STACK_STRING_SIZE */
+
+typedef struct {
+  char* data;
+  size_t size;
+  char buffer[IOTJS_STACK_STRING_SIZE];
+} iotjs_stack_string_t;
+
+void iotjs_jval_as_stack_string(jerry_value_t jval,
+                                iotjs_stack_string_t* out_string);
+void iotjs_free_stack_string(iotjs_stack_string_t* stack_string);
+
 /* Methods for General JavaScript Object */
 void iotjs_jval_set_method(jerry_value_t jobj, const char* name,
                            jerry_external_handler_t handler);
+void iotjs_jval_set_accessor(jerry_value_t jobj, const char* name,
+                             jerry_external_handler_t getter,
+                             jerry_external_handler_t setter);
 bool iotjs_jval_set_prototype(jerry_value_t jobj, jerry_value_t jproto);
 void iotjs_jval_set_property_jval(jerry_value_t jobj, const char* name,
                                   jerry_value_t value);
@@ -73,6 +98,21 @@ void iotjs_jval_set_property_string_raw(jerry_value_t jobj, const char* name,
 
 jerry_value_t iotjs_jval_get_property(jerry_value_t jobj, const char* name);
 
+void iotjs_jval_set_property_by_key(jerry_value_t jobj, jerry_value_t key,
+                                    jerry_value_t value);
+void iotjs_jval_set_property_boolean_by_key(jerry_value_t jobj,
+                                            jerry_value_t key, bool v);
+void iotjs_jval_set_property_number_by_key(jerry_value_t jobj,
+                                           jerry_value_t key, double v);
+void iotjs_jval_set_property_string_by_key(jerry_value_t jobj,
+                                           jerry_value_t key,
+                                           const iotjs_string_t* v);
+void iotjs_jval_set_property_string_raw_by_key(jerry_value_t jobj,
+                                               jerry_value_t key,
+                                               const char* v);
+jerry_value_t iotjs_jval_get_property_by_key(jerry_value_t jobj,
+                                             jerry_value_t key);
+
 void iotjs_jval_set_property_by_index(jerry_value_t jarr, uint32_t idx,
                                       jerry_value_t jval);
 jerry_value_t iotjs_jval_get_property_by_index(jerry_value_t jarr,
@@ -15,6 +15,8 @@
 
 #include "iotjs_def.h"
 
+#include "iotjs_tick.h"
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -75,25 +77,7 @@ bool iotjs_process_next_tick(void) {
     return false;
   }
 
-  const jerry_value_t process = iotjs_module_get("process");
-
-  jerry_value_t jon_next_tick =
-      iotjs_jval_get_property(process, IOTJS_MAGIC_STRING__ONNEXTTICK);
-  IOTJS_ASSERT(jerry_value_is_function(jon_next_tick));
-
-  jerry_value_t jres =
-      jerry_call_function(jon_next_tick, jerry_create_undefined(), NULL, 0);
-
-  bool ret = false;
-
-  if (!jerry_value_is_error(jres)) {
-    ret = iotjs_jval_as_boolean(jres);
-  }
-
-  jerry_release_value(jres);
-  jerry_release_value(jon_next_tick);
-
-  return ret;
+  return iotjs_tick_run();
 }
 
 
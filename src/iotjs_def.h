@@ -117,6 +117,7 @@ extern void force_terminate(void);
 #include "iotjs_magic_strings.h"
 #include "iotjs_module.h"
 #include "iotjs_string.h"
+#include "iotjs_string_ext.h"
 #include "iotjs_util.h"
 
 
@@ -34,8 +34,10 @@
 #define IOTJS_MAGIC_STRING_ADDMEMBERSHIP "addMembership"
 #endif
 #define IOTJS_MAGIC_STRING_ADDRESS "address"
+#define IOTJS_MAGIC_STRING_ALLOCUNSAFE "allocUnsafe"
 #define IOTJS_MAGIC_STRING_ARCH "arch"
 #define IOTJS_MAGIC_STRING_ARGV "argv"
+#define IOTJS_MAGIC_STRING_ASYNCSTATS "asyncStats"
 #define IOTJS_MAGIC_STRING_BASE64 "base64"
 #if ENABLE_MODULE_CRYPTO
 #define IOTJS_MAGIC_STRING_BASE64ENCODE "base64Encode"
@@ -81,6 +83,8 @@
 #define IOTJS_MAGIC_STRING_CHIPSELECT "chipSelect"
 #define IOTJS_MAGIC_STRING_CHIPSELECT_U "CHIPSELECT"
 #endif
+#define IOTJS_MAGIC_STRING_CLASSES "classes"
+#define IOTJS_MAGIC_STRING_CLEARIMMEDIATE "clearImmediate"
 #if ENABLE_MODULE_MQTT
 #define IOTJS_MAGIC_STRING_CLIENTID "clientId"
 #endif
@@ -90,8 +94,10 @@
 #define IOTJS_MAGIC_STRING_COMPARE "compare"
 #define IOTJS_MAGIC_STRING_COMPILE "compile"
 #define IOTJS_MAGIC_STRING_COMPILEMODULE "compileModule"
+#define IOTJS_MAGIC_STRING_CONCAT "concat"
 #define IOTJS_MAGIC_STRING_CONFIG "config"
 #define IOTJS_MAGIC_STRING_CONNECT "connect"
+#define IOTJS_MAGIC_STRING_CONSUME "consume"
 #define IOTJS_MAGIC_STRING_COPY "copy"
 #if ENABLE_MODULE_HTTPS
 #define IOTJS_MAGIC_STRING_CREATEREQUEST "createRequest"
@@ -123,6 +129,7 @@
 #if ENABLE_MODULE_UDP
 #define IOTJS_MAGIC_STRING_DROPMEMBERSHIP "dropMembership"
 #endif
+#define IOTJS_MAGIC_STRING_DROPPEDMESSAGES "droppedMessages"
 #if ENABLE_MODULE_PWM
 #define IOTJS_MAGIC_STRING_DUTYCYCLE "dutyCycle"
 #endif
@@ -132,6 +139,7 @@
 #endif
 #define IOTJS_MAGIC_STRING_EMIT "emit"
 #define IOTJS_MAGIC_STRING_EMITEXIT "emitExit"
+#define IOTJS_MAGIC_STRING_ENABLED "enabled"
 #if ENABLE_MODULE_TLS
 #define IOTJS_MAGIC_STRING_END "end"
 #endif
@@ -144,6 +152,7 @@
 #define IOTJS_MAGIC_STRING_FALLING_U "FALLING"
 #endif
 #define IOTJS_MAGIC_STRING_FAMILY "family"
+#define IOTJS_MAGIC_STRING_FILL "fill"
 #define IOTJS_MAGIC_STRING_FINISH "finish"
 #if ENABLE_MODULE_HTTPS
 #define IOTJS_MAGIC_STRING_FINISHREQUEST "finishRequest"
@@ -151,6 +160,9 @@
 #if ENABLE_MODULE_GPIO
 #define IOTJS_MAGIC_STRING_FLOAT_U "FLOAT"
 #endif
+#if ENABLE_MODULE_UDP
+#define IOTJS_MAGIC_STRING__FLUSHBATCHES "_flushBatches"
+#endif
 #define IOTJS_MAGIC_STRING_FSTAT "fstat"
 #if EXPOSE_GC
 #define IOTJS_MAGIC_STRING_GC "gc"
@@ -161,21 +173,25 @@
 #define IOTJS_MAGIC_STRING_GPIO "Gpio"
 #endif
 #define IOTJS_MAGIC_STRING_HANDLER "handler"
+#define IOTJS_MAGIC_STRING_HANDLES "handles"
 #define IOTJS_MAGIC_STRING_HANDLETIMEOUT "handleTimeout"
 #define IOTJS_MAGIC_STRING_HEADERS "headers"
 #define IOTJS_MAGIC_STRING_HEX "hex"
 #if ENABLE_MODULE_SPI
 #define IOTJS_MAGIC_STRING_HIGH_U "HIGH"
 #endif
+#define IOTJS_MAGIC_STRING_HITS "hits"
 #define IOTJS_MAGIC_STRING_HOME_U "HOME"
 #define IOTJS_MAGIC_STRING_HOST "host"
 #define IOTJS_MAGIC_STRING_HTTPPARSER "HTTPParser"
 #define IOTJS_MAGIC_STRING_HTTP_VERSION_MAJOR "http_major"
 #define IOTJS_MAGIC_STRING_HTTP_VERSION_MINOR "http_minor"
+#define IOTJS_MAGIC_STRING_IDLETIME "idleTime"
 #if ENABLE_MODULE_GPIO
 #define IOTJS_MAGIC_STRING_IN "IN"
 #endif
 #define IOTJS_MAGIC_STRING__INCOMING "_incoming"
+#define IOTJS_MAGIC_STRING_INDEXOF "indexOf"
 #define IOTJS_MAGIC_STRING_IOTJS_ENV_U "IOTJS_ENV"
 #define IOTJS_MAGIC_STRING_IOTJS_PATH_U "IOTJS_PATH"
 #define IOTJS_MAGIC_STRING_IOTJS_EXTRA_MODULE_PATH_U "IOTJS_EXTRA_MODULE_PATH"
@@ -186,6 +202,7 @@
 #define IOTJS_MAGIC_STRING_ISALIVEEXCEPTFOR "isAliveExceptFor"
 #define IOTJS_MAGIC_STRING_ISDEVUP "isDevUp"
 #define IOTJS_MAGIC_STRING_ISDIRECTORY "isDirectory"
+#define IOTJS_MAGIC_STRING_ISEXECUTING "isExecuting"
 #define IOTJS_MAGIC_STRING_ISFILE "isFile"
 #if ENABLE_MODULE_TLS
 #define IOTJS_MAGIC_STRING_ISSERVER "isServer"
@@ -194,18 +211,23 @@
 #define IOTJS_MAGIC_STRING_KEEPALIVE "keepalive"
 #endif
 #define IOTJS_MAGIC_STRING_KEY "key"
+#define IOTJS_MAGIC_STRING_LARGELIVE "largeLive"
 #define IOTJS_MAGIC_STRING_LENGTH "length"
 #define IOTJS_MAGIC_STRING_LISTEN "listen"
+#define IOTJS_MAGIC_STRING_LIVE "live"
 #define IOTJS_MAGIC_STRING_LOOPBACK "loopback"
 #if ENABLE_MODULE_SPI
 #define IOTJS_MAGIC_STRING_LSB "LSB"
 #define IOTJS_MAGIC_STRING_MAXSPEED "maxSpeed"
 #endif
+#define IOTJS_MAGIC_STRING_MAXPOOLEDBYTES "maxPooledBytes"
+#define IOTJS_MAGIC_STRING_MAX_QUEUE_SIZE_U "MAX_QUEUE_SIZE"
 #if ENABLE_MODULE_MQTT || ENABLE_MODULE_WEBSOCKET
 #define IOTJS_MAGIC_STRING_MESSAGE "message"
 #endif
 #define IOTJS_MAGIC_STRING_METHOD "method"
 #define IOTJS_MAGIC_STRING_METHODS "methods"
+#define IOTJS_MAGIC_STRING_MISSES "misses"
 #define IOTJS_MAGIC_STRING_MKDIR "mkdir"
 #define IOTJS_MAGIC_STRING_MODE "mode"
 #if ENABLE_MODULE_SPI || ENABLE_MODULE_GPIO
@@ -219,9 +241,11 @@
 #if ENABLE_MODULE_SPI
 #define IOTJS_MAGIC_STRING_MSB "MSB"
 #endif
+#define IOTJS_MAGIC_STRING_NEXTTICK "nextTick"
 #if ENABLE_MODULE_SPI || ENABLE_MODULE_GPIO
 #define IOTJS_MAGIC_STRING_NONE_U "NONE"
 #endif
+#define IOTJS_MAGIC_STRING_NOW "now"
 #if ENABLE_MODULE_MQTT
 #define IOTJS_MAGIC_STRING_ONACK "onack"
 #endif
@@ -232,12 +256,16 @@
 #define IOTJS_MAGIC_STRING_ONDATA "onData"
 #define IOTJS_MAGIC_STRING_ONEND "onEnd"
 #define IOTJS_MAGIC_STRING_ONERROR "onError"
+#define IOTJS_MAGIC_STRING_ONEXECUTEERROR "OnExecuteError"
 #if ENABLE_MODULE_TLS
 #define IOTJS_MAGIC_STRING_ONHANDSHAKEDONE "onhandshakedone"
 #endif
 #define IOTJS_MAGIC_STRING_ONHEADERSCOMPLETE "OnHeadersComplete"
 #define IOTJS_MAGIC_STRING_ONHEADERS "OnHeaders"
 #define IOTJS_MAGIC_STRING_ONMESSAGECOMPLETE "OnMessageComplete"
+#if ENABLE_MODULE_UDP
+#define IOTJS_MAGIC_STRING_ONMESSAGES "onmessages"
+#endif
 #define IOTJS_MAGIC_STRING_ONMESSAGE "onmessage"
 #define IOTJS_MAGIC_STRING__ONNEXTTICK "_onNextTick"
 #if ENABLE_MODULE_WEBSOCKET
@@ -283,6 +311,9 @@
 #if ENABLE_MODULE_WEBSOCKET
 #define IOTJS_MAGIC_STRING_PONG "pong"
 #endif
+#define IOTJS_MAGIC_STRING_POOLED "pooled"
+#define IOTJS_MAGIC_STRING_POOLEDBYTES "pooledBytes"
+#define IOTJS_MAGIC_STRING_POOLSTATS "poolStats"
 #define IOTJS_MAGIC_STRING_PORT "port"
 #if ENABLE_MODULE_WEBSOCKET
 #define IOTJS_MAGIC_STRING_PREPAREHANDSHAKE "prepareHandshake"
@@ -300,17 +331,34 @@
 #if ENABLE_MODULE_MQTT
 #define IOTJS_MAGIC_STRING_QOS "qos"
 #endif
+#define IOTJS_MAGIC_STRING_QUEUEDBYTES "queuedBytes"
+#define IOTJS_MAGIC_STRING_RAWHEADEROFFSETS "rawHeaderOffsets"
+#define IOTJS_MAGIC_STRING_RAWHEADERS "rawHeaders"
 #define IOTJS_MAGIC_STRING_READDIR "readdir"
 #define IOTJS_MAGIC_STRING_READ "read"
 #define IOTJS_MAGIC_STRING_READSOURCE "readSource"
 #define IOTJS_MAGIC_STRING_READSTART "readStart"
+#define IOTJS_MAGIC_STRING_READSTOP "readStop"
 #define IOTJS_MAGIC_STRING_READSYNC "readSync"
+#define IOTJS_MAGIC_STRING_READDOUBLEBE "readDoubleBE"
+#define IOTJS_MAGIC_STRING_READDOUBLELE "readDoubleLE"
+#define IOTJS_MAGIC_STRING_READFLOATBE "readFloatBE"
+#define IOTJS_MAGIC_STRING_READFLOATLE "readFloatLE"
+#define IOTJS_MAGIC_STRING_READINT16BE "readInt16BE"
+#define IOTJS_MAGIC_STRING_READINT16LE "readInt16LE"
+#define IOTJS_MAGIC_STRING_READINT32BE "readInt32BE"
+#define IOTJS_MAGIC_STRING_READINT32LE "readInt32LE"
 #define IOTJS_MAGIC_STRING_READUINT8 "readUInt8"
+#define IOTJS_MAGIC_STRING_READUINT16BE "readUInt16BE"
+#define IOTJS_MAGIC_STRING_READUINT16LE "readUInt16LE"
+#define IOTJS_MAGIC_STRING_READUINT32BE "readUInt32BE"
+#define IOTJS_MAGIC_STRING_READUINT32LE "readUInt32LE"
 #if ENABLE_MODULE_DGRAM
 #define IOTJS_MAGIC_STRING_RECVSTART "recvStart"
 #define IOTJS_MAGIC_STRING_RECVSTOP "recvStop"
 #endif
 #define IOTJS_MAGIC_STRING_REF "ref"
+#define IOTJS_MAGIC_STRING_REINITIALIZE "reinitialize"
 #if ENABLE_MODULE_TLS || ENABLE_MODULE_HTTPS
 #define IOTJS_MAGIC_STRING_REJECTUNAUTHORIZED "rejectUnauthorized"
 #endif
@@ -318,6 +366,7 @@
 #define IOTJS_MAGIC_STRING_REMAINING "remaining"
 #endif
 #define IOTJS_MAGIC_STRING_RENAME "rename"
+#define IOTJS_MAGIC_STRING_REQUESTS "requests"
 #define IOTJS_MAGIC_STRING_REQUEST_U "REQUEST"
 #define IOTJS_MAGIC_STRING_RESPONSE_U "RESPONSE"
 #define IOTJS_MAGIC_STRING_RESUME "resume"
@@ -336,6 +385,9 @@
 #if ENABLE_MODULE_MQTT
 #define IOTJS_MAGIC_STRING_SENDACK "sendAck"
 #endif
+#if ENABLE_MODULE_UDP
+#define IOTJS_MAGIC_STRING_SENDBATCH "sendBatch"
+#endif
 #define IOTJS_MAGIC_STRING_SENDREQUEST "sendRequest"
 #if ENABLE_MODULE_TLS
 #define IOTJS_MAGIC_STRING_SERVERNAME "servername"
@@ -343,6 +395,7 @@
 #if ENABLE_MODULE_I2C
 #define IOTJS_MAGIC_STRING_SETADDRESS "setAddress"
 #endif
+#define IOTJS_MAGIC_STRING_SETASYNC "setAsync"
 #if ENABLE_MODULE_UDP
 #define IOTJS_MAGIC_STRING_CONFIGURE "configure"
 #endif
@@ -360,6 +413,7 @@
 #if ENABLE_MODULE_BLE
 #define IOTJS_MAGIC_STRING_SETFILTER "setFilter"
 #endif
+#define IOTJS_MAGIC_STRING_SETIMMEDIATE "setImmediate"
 #define IOTJS_MAGIC_STRING_SETKEEPALIVE "setKeepAlive"
 #if ENABLE_MODULE_PWM
 #define IOTJS_MAGIC_STRING_SETPERIOD "setPeriod"
@@ -371,6 +425,7 @@
 #endif
 #define IOTJS_MAGIC_STRING_SHOULDKEEPALIVE "shouldkeepalive"
 #define IOTJS_MAGIC_STRING_SHUTDOWN "shutdown"
+#define IOTJS_MAGIC_STRING_SIZE "size"
 #define IOTJS_MAGIC_STRING_SLICE "slice"
 #if ENABLE_MODULE_SPI
 #define IOTJS_MAGIC_STRING_SPI "Spi"
@@ -399,6 +454,7 @@
 #define IOTJS_MAGIC_STRING_TRANSFER "transfer"
 #define IOTJS_MAGIC_STRING_TRANSFERSYNC "transferSync"
 #endif
+#define IOTJS_MAGIC_STRING_UNCONSUME "unconsume"
 #define IOTJS_MAGIC_STRING_UNLINK "unlink"
 #define IOTJS_MAGIC_STRING_UNREF "unref"
 #if ENABLE_MODULE_MQTT
@@ -409,14 +465,28 @@
 #define IOTJS_MAGIC_STRING_USERNAME "username"
 #endif
 #define IOTJS_MAGIC_STRING_URL "url"
+#define IOTJS_MAGIC_STRING_UVPOOLSTATS "uvPoolStats"
 #define IOTJS_MAGIC_STRING_VERSION "version"
 #if ENABLE_MODULE_MQTT
 #define IOTJS_MAGIC_STRING_WILL "will"
 #endif
+#define IOTJS_MAGIC_STRING_WRITEDOUBLEBE "writeDoubleBE"
+#define IOTJS_MAGIC_STRING_WRITEDOUBLELE "writeDoubleLE"
+#define IOTJS_MAGIC_STRING_WRITEFLOATBE "writeFloatBE"
+#define IOTJS_MAGIC_STRING_WRITEFLOATLE "writeFloatLE"
+#define IOTJS_MAGIC_STRING_WRITEINT16BE "writeInt16BE"
+#define IOTJS_MAGIC_STRING_WRITEINT16LE "writeInt16LE"
+#define IOTJS_MAGIC_STRING_WRITEINT32BE "writeInt32BE"
+#define IOTJS_MAGIC_STRING_WRITEINT32LE "writeInt32LE"
 #define IOTJS_MAGIC_STRING_WRITEUINT8 "writeUInt8"
+#define IOTJS_MAGIC_STRING_WRITEUINT16BE "writeUInt16BE"
+#define IOTJS_MAGIC_STRING_WRITEUINT16LE "writeUInt16LE"
+#define IOTJS_MAGIC_STRING_WRITEUINT32BE "writeUInt32BE"
+#define IOTJS_MAGIC_STRING_WRITEUINT32LE "writeUInt32LE"
 #define IOTJS_MAGIC_STRING_WRITE "write"
 #define IOTJS_MAGIC_STRING_WRITEDECODE "writeDecode"
 #define IOTJS_MAGIC_STRING_WRITESYNC "writeSync"
+#define IOTJS_MAGIC_STRING_WRITEV "writev"
 #if ENABLE_MODULE_HTTPS
 #define IOTJS_MAGIC_STRING__WRITE "_write"
 #endif
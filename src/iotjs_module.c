@@ -27,6 +27,44 @@ typedef struct { jerry_value_t jmodule; } iotjs_module_rw_data_t;
  *  - iotjs_module_rw_data[]
  */
 
+// Slots of the native module lookup table, must be a power of two larger
+// than the number of native modules.
+#define IOTJS_MODULE_HASH_SIZE 128
+
+// Open addressing table of module indices plus one, zero marks a free slot.
+static uint8_t iotjs_module_hash_table[IOTJS_MODULE_HASH_SIZE];
+static bool iotjs_module_hash_ready = false;
+
+
+uint32_t iotjs_module_hash(const char* name, uint32_t seed) {
+  uint32_t hash = 2166136261u ^ seed;
+
+  for (; *name != '\0'; name++) {
+    hash ^= (uint8_t)*name;
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+
+static void iotjs_module_hash_init(void) {
+  IOTJS_ASSERT(iotjs_module_count < IOTJS_MODULE_HASH_SIZE);
+
+  for (unsigned i = 0; i < iotjs_module_count; i++) {
+    uint32_t slot = iotjs_module_hash(iotjs_module_ro_data[i].name, 0) &
+                    (IOTJS_MODULE_HASH_SIZE - 1);
+
+    while (iotjs_module_hash_table[slot] != 0) {
+      slot = (slot + 1) & (IOTJS_MODULE_HASH_SIZE - 1);
+    }
+    iotjs_module_hash_table[slot] = (uint8_t)(i + 1);
+  }
+
+  iotjs_module_hash_ready = true;
+}
+
+
 void iotjs_module_list_cleanup(void) {
   for (unsigned i = 0; i < iotjs_module_count; i++) {
     if (iotjs_module_rw_data[i].jmodule != 0) {
@@ -37,7 +75,15 @@ void iotjs_module_list_cleanup(void) {
 }
 
 jerry_value_t iotjs_module_get(const char* name) {
-  for (unsigned i = 0; i < iotjs_module_count; i++) {
+  if (!iotjs_module_hash_ready) {
+    iotjs_module_hash_init();
+  }
+
+  uint32_t slot = iotjs_module_hash(name, 0) & (IOTJS_MODULE_HASH_SIZE - 1);
+
+  while (iotjs_module_hash_table[slot] != 0) {
+    unsigned i = iotjs_module_hash_table[slot] - 1u;
+
     if (!strcmp(name, iotjs_module_ro_data[i].name)) {
       if (iotjs_module_rw_data[i].jmodule == 0) {
         iotjs_module_rw_data[i].jmodule = iotjs_module_ro_data[i].fn_register();
@@ -45,6 +91,8 @@ jerry_value_t iotjs_module_get(const char* name) {
 
       return iotjs_module_rw_data[i].jmodule;
     }
+
+    slot = (slot + 1) & (IOTJS_MODULE_HASH_SIZE - 1);
   }
 
   return jerry_create_undefined();
@@ -32,4 +32,8 @@ void iotjs_module_list_cleanup(void);
 
 jerry_value_t iotjs_module_get(const char* name);
 
+// FNV-1a hash of a module name. tools/js2c.py computes the same hash to
+// build the lookup table of the JS modules.
+uint32_t iotjs_module_hash(const char* name, uint32_t seed);
+
 #endif /* IOTJS_MODULE_H */
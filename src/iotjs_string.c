@@ -26,21 +26,17 @@ iotjs_string_t iotjs_string_create(void) {
 
   str.size = 0;
   str.data = NULL;
+  str.inline_data[0] = '\0';
 
   return str;
 }
 
 
 iotjs_string_t iotjs_string_create_with_size(const char* data, size_t size) {
-  iotjs_string_t str;
-
-  str.size = size;
+  iotjs_string_t str = iotjs_string_create();
 
   if (data && size > 0) {
-    str.data = iotjs_buffer_allocate(size);
-    memcpy(str.data, data, size);
-  } else {
-    str.data = NULL;
+    memcpy(iotjs_string_reserve(&str, size), data, size);
   }
 
   return str;
@@ -48,7 +44,7 @@ iotjs_string_t iotjs_string_create_with_size(const char* data, size_t size) {
 
 
 iotjs_string_t iotjs_string_create_with_buffer(char* buffer, size_t size) {
-  iotjs_string_t str;
+  iotjs_string_t str = iotjs_string_create();
 
   str.size = size;
 
@@ -56,16 +52,33 @@ iotjs_string_t iotjs_string_create_with_buffer(char* buffer, size_t size) {
     IOTJS_ASSERT(buffer != NULL);
     str.data = buffer;
   } else {
-    str.data = NULL;
+    iotjs_buffer_release(buffer);
   }
 
   return str;
 }
 
 
+char* iotjs_string_reserve(iotjs_string_t* str, size_t size) {
+  IOTJS_ASSERT(str->size == 0 && str->data == NULL);
+
+  str->size = size;
+
+  if (size <= IOTJS_STRING_INLINE_SIZE) {
+    str->inline_data[size] = '\0';
+    return str->inline_data;
+  }
+
+  str->data = iotjs_buffer_allocate_uninitialized(size + 1);
+  str->data[size] = '\0';
+  return str->data;
+}
+
+
 void iotjs_string_destroy(iotjs_string_t* str) {
   IOTJS_RELEASE(str->data);
   str->size = 0;
+  str->inline_data[0] = '\0';
 }
 
 
@@ -80,21 +93,26 @@ void iotjs_string_append(iotjs_string_t* str, const char* data, size_t size) {
     return;
   }
 
+  size_t new_size = str->size + size;
+
   if (str->data != NULL) {
-    str->data = iotjs_buffer_reallocate(str->data, str->size + size);
-  } else {
-    IOTJS_ASSERT(str->size == 0);
-    str->data = iotjs_buffer_allocate(size);
+    str->data = iotjs_buffer_reallocate(str->data, new_size + 1);
+  } else if (new_size > IOTJS_STRING_INLINE_SIZE) {
+    // Move the inline bytes to the heap.
+    str->data = iotjs_buffer_allocate_uninitialized(new_size + 1);
+    memcpy(str->data, str->inline_data, str->size);
   }
 
-  memcpy(str->data + str->size, data, size);
-  str->size += size;
+  char* storage = str->data != NULL ? str->data : str->inline_data;
+  memcpy(storage + str->size, data, size);
+  storage[new_size] = '\0';
+  str->size = new_size;
 }
 
 
 const char* iotjs_string_data(const iotjs_string_t* str) {
   if (str->data == NULL) {
-    return "";
+    return str->inline_data;
   }
 
   return str->data;
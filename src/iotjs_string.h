@@ -18,9 +18,23 @@
 
 #include <stdbool.h>
 
+// Strings up to this size are stored in the string itself.
+#ifndef IOTJS_STRING_INLINE_SIZE
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_STRING_INLINE_SIZE 24
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_STRING_INLINE_SIZE 64
+#endif /* __NUTTX__ || __TIZENRT__ */
+#endif /* IOTJS_STRING_INLINE_SIZE */
+
+// Strings may be copied by value, so the bytes must always be accessed
+// through iotjs_string_data().
 typedef struct {
   size_t size;
+  // Heap storage, NULL if the bytes are in `inline_data`.
   char* data;
+  // Zero terminated storage of short strings.
+  char inline_data[IOTJS_STRING_INLINE_SIZE + 1];
 } iotjs_string_t;
 
 // Create new string
@@ -28,6 +42,10 @@ iotjs_string_t iotjs_string_create(void);
 iotjs_string_t iotjs_string_create_with_size(const char* data, size_t size);
 iotjs_string_t iotjs_string_create_with_buffer(char* buffer, size_t size);
 
+// Makes an empty string `size` bytes long and returns its storage, which
+// the caller must fill. The terminating zero is already set.
+char* iotjs_string_reserve(iotjs_string_t* str, size_t size);
+
 // Destroy string
 void iotjs_string_destroy(iotjs_string_t* str);
 
@@ -58,9 +58,28 @@ static const jerry_char_t *const magic_string_items[] = {
 };
 
 
+jerry_value_t iotjs_keys[IOTJS_KEY_COUNT];
+
+
 void iotjs_register_jerry_magic_string(void) {
   uint32_t num_magic_string_items =
       (uint32_t)(sizeof(magic_string_items) / sizeof(jerry_char_t *));
   jerry_register_magic_strings(magic_string_items, num_magic_string_items,
                                magic_string_lengths);
+
+#define V(NAME)                   \
+  IOTJS_KEY(NAME) =               \
+      jerry_create_string((const jerry_char_t *)IOTJS_MAGIC_STRING_##NAME);
+
+  IOTJS_KEY_LIST(V)
+
+#undef V
+}
+
+
+void iotjs_release_jerry_magic_string(void) {
+  for (size_t i = 0; i < IOTJS_KEY_COUNT; i++) {
+    jerry_release_value(iotjs_keys[i]);
+    iotjs_keys[i] = jerry_create_undefined();
+  }
 }
@@ -16,8 +16,54 @@
 #ifndef IOTJS_STRING_EXT_H
 #define IOTJS_STRING_EXT_H
 
+#include "jerryscript.h"
+
+
+/**
+ * Property keys of the hot paths, created once when the magic strings are
+ * registered and kept until the engine is released. Pass them to the
+ * `_by_key` helpers of iotjs_binding.h instead of the IOTJS_MAGIC_STRING_*
+ * literal, which is converted to a string on every call.
+ *
+ * Only unconditional magic strings can be listed here.
+ */
+#define IOTJS_KEY_LIST(V) \
+  V(ADDRESS)              \
+  V(CREATETCP)            \
+  V(DATA)                 \
+  V(FAMILY)               \
+  V(HEADERS)              \
+  V(HTTP_VERSION_MAJOR)   \
+  V(HTTP_VERSION_MINOR)   \
+  V(IPV4)                 \
+  V(IPV6)                 \
+  V(LENGTH)               \
+  V(METHOD)               \
+  V(ONCLOSE)              \
+  V(ONCONNECTION)         \
+  V(PORT)                 \
+  V(RAWHEADEROFFSETS)     \
+  V(RAWHEADERS)           \
+  V(SHOULDKEEPALIVE)      \
+  V(STATUS)               \
+  V(STATUS_MSG)           \
+  V(UPGRADE)              \
+  V(URL)
+
+typedef enum {
+#define V(NAME) IOTJS_KEY_INDEX_##NAME,
+  IOTJS_KEY_LIST(V)
+#undef V
+  IOTJS_KEY_COUNT
+} iotjs_key_index_t;
+
+extern jerry_value_t iotjs_keys[IOTJS_KEY_COUNT];
+
+#define IOTJS_KEY(NAME) (iotjs_keys[IOTJS_KEY_INDEX_##NAME])
+
 
 void iotjs_register_jerry_magic_string(void);
+void iotjs_release_jerry_magic_string(void);
 
 
 #endif /* IOTJS_STRING_EXT_H */
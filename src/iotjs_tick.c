@@ -0,0 +1,280 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "iotjs_def.h"
+
+#include "iotjs_tick.h"
+
+
+// Arguments stored in the queue entry itself. Calls with more arguments keep
+// them in an array.
+#define IOTJS_TICK_INLINE_ARGS 3
+#define IOTJS_TICK_INITIAL_CAPACITY 16
+
+
+typedef struct {
+  jerry_value_t jfunc;
+  // `jargs[0]` is an array of all arguments if `argc` is larger than
+  // IOTJS_TICK_INLINE_ARGS.
+  jerry_value_t jargs[IOTJS_TICK_INLINE_ARGS];
+  uint32_t argc;
+} iotjs_tick_t;
+
+
+typedef struct {
+  iotjs_tick_t* ticks;
+  // Always a power of two.
+  uint32_t capacity;
+  uint32_t head;
+  uint32_t length;
+  // Id of the entry at `head`, ids increase by one per queued entry.
+  uint32_t head_id;
+} iotjs_tick_queue_t;
+
+
+static iotjs_tick_queue_t tick_queue;
+static iotjs_tick_queue_t immediate_queue;
+
+// `true` while the next tick queue is being processed.
+static bool tick_running;
+
+// The check handle runs the immediates, the idle handle keeps the loop from
+// blocking for I/O while callbacks are queued.
+static uv_check_t immediate_check;
+static uv_idle_t tick_idle;
+static bool tick_handles_initialized;
+
+
+static uint32_t tick_queue_push(iotjs_tick_queue_t* queue, jerry_value_t jfunc,
+                                const jerry_value_t* jargv, size_t jargc) {
+  if (queue->length == queue->capacity) {
+    uint32_t capacity = queue->capacity ? queue->capacity * 2
+                                        : IOTJS_TICK_INITIAL_CAPACITY;
+    iotjs_tick_t* ticks = IOTJS_CALLOC(capacity, iotjs_tick_t);
+
+    for (uint32_t i = 0; i < queue->length; i++) {
+      ticks[i] = queue->ticks[(queue->head + i) & (queue->capacity - 1)];
+    }
+
+    IOTJS_RELEASE(queue->ticks);
+    queue->ticks = ticks;
+    queue->capacity = capacity;
+    queue->head = 0;
+  }
+
+  uint32_t index = (queue->head + queue->length) & (queue->capacity - 1);
+  iotjs_tick_t* tick = &queue->ticks[index];
+
+  tick->jfunc = jerry_acquire_value(jfunc);
+  tick->argc = (uint32_t)jargc;
+
+  if (jargc <= IOTJS_TICK_INLINE_ARGS) {
+    for (size_t i = 0; i < jargc; i++) {
+      tick->jargs[i] = jerry_acquire_value(jargv[i]);
+    }
+  } else {
+    jerry_value_t jarray = jerry_create_array((uint32_t)jargc);
+    for (uint32_t i = 0; i < jargc; i++) {
+      iotjs_jval_set_property_by_index(jarray, i, jargv[i]);
+    }
+    tick->jargs[0] = jarray;
+  }
+
+  return queue->head_id + queue->length++;
+}
+
+
+static void tick_release(iotjs_tick_t* tick) {
+  jerry_release_value(tick->jfunc);
+
+  uint32_t count = tick->argc;
+  if (count > IOTJS_TICK_INLINE_ARGS) {
+    count = 1;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    jerry_release_value(tick->jargs[i]);
+  }
+
+  tick->jfunc = jerry_create_undefined();
+  tick->argc = 0;
+}
+
+
+static void tick_queue_pop(iotjs_tick_queue_t* queue, iotjs_tick_t* tick) {
+  IOTJS_ASSERT(queue->length > 0);
+
+  *tick = queue->ticks[queue->head];
+  queue->head = (queue->head + 1) & (queue->capacity - 1);
+  queue->length--;
+  queue->head_id++;
+}
+
+
+static void tick_queue_destroy(iotjs_tick_queue_t* queue) {
+  while (queue->length > 0) {
+    iotjs_tick_t tick;
+    tick_queue_pop(queue, &tick);
+    tick_release(&tick);
+  }
+
+  IOTJS_RELEASE(queue->ticks);
+  memset(queue, 0, sizeof(iotjs_tick_queue_t));
+}
+
+
+// Calls the popped entry and releases it.
+static void tick_call(iotjs_tick_t* tick) {
+  if (jerry_value_is_function(tick->jfunc)) {
+    jerry_value_t jres;
+
+    if (tick->argc <= IOTJS_TICK_INLINE_ARGS) {
+      jres = jerry_call_function(tick->jfunc, jerry_create_undefined(),
+                                 tick->jargs, tick->argc);
+    } else {
+      jerry_value_t* jargv = IOTJS_CALLOC(tick->argc, jerry_value_t);
+      for (uint32_t i = 0; i < tick->argc; i++) {
+        jargv[i] = iotjs_jval_get_property_by_index(tick->jargs[0], i);
+      }
+
+      jres = jerry_call_function(tick->jfunc, jerry_create_undefined(), jargv,
+                                 tick->argc);
+
+      for (uint32_t i = 0; i < tick->argc; i++) {
+        jerry_release_value(jargv[i]);
+      }
+      IOTJS_RELEASE(jargv);
+    }
+
+    if (jerry_value_is_error(jres)) {
+      jerry_value_t errval = jerry_get_value_from_error(jres, false);
+      iotjs_uncaught_exception(errval);
+      jerry_release_value(errval);
+    }
+    jerry_release_value(jres);
+  }
+
+  tick_release(tick);
+}
+
+
+static void tick_idle_cb(uv_idle_t* handle) {
+  // Nothing to do, an active idle handle only makes the poll not block.
+}
+
+
+static void immediate_check_cb(uv_check_t* handle);
+
+
+static void tick_update_handles(void) {
+  if (tick_queue.length > 0 || immediate_queue.length > 0) {
+    if (!tick_handles_initialized) {
+      uv_loop_t* loop = iotjs_environment_loop(iotjs_environment_get());
+      uv_check_init(loop, &immediate_check);
+      uv_idle_init(loop, &tick_idle);
+      tick_handles_initialized = true;
+    }
+    uv_check_start(&immediate_check, immediate_check_cb);
+    uv_idle_start(&tick_idle, tick_idle_cb);
+  } else if (tick_handles_initialized) {
+    uv_check_stop(&immediate_check);
+    uv_idle_stop(&tick_idle);
+  }
+}
+
+
+static void immediate_check_cb(uv_check_t* handle) {
+  iotjs_environment_t* env = iotjs_environment_get();
+
+  // Immediates queued from now on run on the next iteration.
+  uint32_t count = immediate_queue.length;
+
+  while (count-- > 0 && !iotjs_environment_is_exiting(env)) {
+    iotjs_tick_t tick;
+    tick_queue_pop(&immediate_queue, &tick);
+    tick_call(&tick);
+
+    iotjs_process_next_tick();
+  }
+
+  tick_update_handles();
+}
+
+
+void iotjs_tick_push(jerry_value_t jfunc, const jerry_value_t* jargv,
+                     size_t jargc) {
+  tick_queue_push(&tick_queue, jfunc, jargv, jargc);
+  if (tick_queue.length == 1) {
+    tick_update_handles();
+  }
+}
+
+
+// Runs the ticks queued before the call. Returns `true` if there are more
+// ticks queued by them.
+bool iotjs_tick_run(void) {
+  if (tick_running) {
+    return tick_queue.length > 0;
+  }
+
+  iotjs_environment_t* env = iotjs_environment_get();
+  uint32_t count = tick_queue.length;
+
+  tick_running = true;
+  while (count-- > 0 && !iotjs_environment_is_exiting(env)) {
+    iotjs_tick_t tick;
+    tick_queue_pop(&tick_queue, &tick);
+    tick_call(&tick);
+  }
+  tick_running = false;
+
+  tick_update_handles();
+
+  return tick_queue.length > 0;
+}
+
+
+uint32_t iotjs_immediate_push(jerry_value_t jfunc, const jerry_value_t* jargv,
+                              size_t jargc) {
+  uint32_t id = tick_queue_push(&immediate_queue, jfunc, jargv, jargc);
+  if (immediate_queue.length == 1) {
+    tick_update_handles();
+  }
+  return id;
+}
+
+
+// Cancels a queued immediate. Ids of immediates that already ran are ignored.
+void iotjs_immediate_clear(uint32_t id) {
+  uint32_t offset = id - immediate_queue.head_id;
+
+  if (offset < immediate_queue.length) {
+    uint32_t index =
+        (immediate_queue.head + offset) & (immediate_queue.capacity - 1);
+    tick_release(&immediate_queue.ticks[index]);
+  }
+}
+
+
+void iotjs_tick_cleanup(void) {
+  if (tick_handles_initialized) {
+    uv_close((uv_handle_t*)&immediate_check, NULL);
+    uv_close((uv_handle_t*)&tick_idle, NULL);
+    tick_handles_initialized = false;
+  }
+
+  tick_queue_destroy(&tick_queue);
+  tick_queue_destroy(&immediate_queue);
+  tick_running = false;
+}
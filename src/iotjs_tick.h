@@ -0,0 +1,46 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IOTJS_TICK_H
+#define IOTJS_TICK_H
+
+#include "iotjs_binding.h"
+
+/**
+ * Deferred callbacks run in the following phases of every loop iteration:
+ *
+ *  - next ticks: queued by `process.nextTick()`, run after every callback
+ *    made from the event loop, and once more after each iteration.
+ *  - immediates: queued by `setImmediate()`, run from a uv_check handle,
+ *    right after the I/O callbacks of the iteration. Immediates queued by
+ *    an immediate run on the next iteration.
+ *  - promise jobs: run at the end of every iteration, after the ticks.
+ *
+ * Both queues are ring buffers of (function, arguments) pairs, so queueing
+ * a callback does not allocate once the ring has grown to its working size.
+ * While any callback is queued the loop does not block for I/O.
+ */
+
+void iotjs_tick_push(jerry_value_t jfunc, const jerry_value_t* jargv,
+                     size_t jargc);
+bool iotjs_tick_run(void);
+
+uint32_t iotjs_immediate_push(jerry_value_t jfunc, const jerry_value_t* jargv,
+                              size_t jargc);
+void iotjs_immediate_clear(uint32_t id);
+
+void iotjs_tick_cleanup(void);
+
+#endif /* IOTJS_TICK_H */
@@ -85,6 +85,16 @@ char* iotjs_buffer_allocate(size_t size) {
 }
 
 
+char* iotjs_buffer_allocate_uninitialized(size_t size) {
+  char* buffer = (char*)(malloc(size));
+  if (buffer == NULL && size > 0) {
+    DLOG("Out of memory");
+    force_terminate();
+  }
+  return buffer;
+}
+
+
 char* iotjs_buffer_allocate_from_number_array(size_t size,
                                               const jerry_value_t array) {
   char* buffer = iotjs_buffer_allocate(size);
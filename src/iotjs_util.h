@@ -24,6 +24,8 @@
 iotjs_string_t iotjs_file_read(const char* path);
 
 char* iotjs_buffer_allocate(size_t size);
+// Same as iotjs_buffer_allocate() but the memory is not zero filled.
+char* iotjs_buffer_allocate_uninitialized(size_t size);
 char* iotjs_buffer_allocate_from_number_array(size_t size,
                                               const jerry_value_t array);
 char* iotjs_buffer_reallocate(char* buffer, size_t size);
@@ -16,6 +16,7 @@
 #include "iotjs_def.h"
 
 #include "iotjs_uv_handle.h"
+#include "iotjs_uv_pool.h"
 
 
 uv_handle_t* iotjs_uv_handle_create(size_t handle_size,
@@ -27,13 +28,17 @@ uv_handle_t* iotjs_uv_handle_create(size_t handle_size,
   /* Make sure that the jerry_value_t is aligned */
   size_t aligned_request_size = IOTJS_ALIGNUP(handle_size, 8u);
 
-  char* request_memory = iotjs_buffer_allocate(
+  char* request_memory = (char*)iotjs_uv_pool_alloc(
+      kUvPoolHandle,
       aligned_request_size + sizeof(iotjs_uv_handle_data) + extra_data_size);
   uv_handle_t* uv_handle = (uv_handle_t*)request_memory;
   uv_handle->data = request_memory + aligned_request_size;
 
   IOTJS_UV_HANDLE_DATA(uv_handle)->jobject = jobject;
   IOTJS_UV_HANDLE_DATA(uv_handle)->on_close_cb = NULL;
+  for (size_t i = 0; i < IOTJS_UV_HANDLE_SLOTS; i++) {
+    IOTJS_UV_HANDLE_SLOT(uv_handle, i) = jerry_create_undefined();
+  }
   jerry_acquire_value(jobject);
 
   jerry_set_object_native_pointer(jobject, uv_handle, native_info);
@@ -49,10 +54,28 @@ static void iotjs_uv_handle_close_processor(uv_handle_t* handle) {
     handle_data->on_close_cb(handle);
   }
 
+  for (size_t i = 0; i < IOTJS_UV_HANDLE_SLOTS; i++) {
+    jerry_release_value(handle_data->jslots[i]);
+  }
+
   // Decrease ref count of Javascript object. From now the object can be
   // reclaimed.
   jerry_release_value(handle_data->jobject);
-  IOTJS_RELEASE(handle);
+  iotjs_uv_handle_free(handle);
+}
+
+
+void iotjs_uv_handle_free(uv_handle_t* handle) {
+  iotjs_uv_pool_free(handle);
+}
+
+
+void iotjs_uv_handle_set_slot(uv_handle_t* handle, size_t slot,
+                              jerry_value_t value) {
+  IOTJS_ASSERT(slot < IOTJS_UV_HANDLE_SLOTS);
+
+  jerry_release_value(IOTJS_UV_HANDLE_SLOT(handle, slot));
+  IOTJS_UV_HANDLE_SLOT(handle, slot) = jerry_acquire_value(value);
 }
 
 
@@ -62,7 +85,9 @@ void iotjs_uv_handle_close(uv_handle_t* handle, OnCloseHandler close_handler) {
     return;
   }
 
-  iotjs_uv_handle_data* handle_data = IOTJS_UV_HANDLE_DATA(handle);
-  handle_data->on_close_cb = close_handler;
+  // Without a handler the one set up by the owner of the handle is kept.
+  if (close_handler != NULL) {
+    IOTJS_UV_HANDLE_DATA(handle)->on_close_cb = close_handler;
+  }
   uv_close(handle, iotjs_uv_handle_close_processor);
 }
@@ -22,9 +22,14 @@
 
 typedef void (*OnCloseHandler)(uv_handle_t*);
 
+// Number of values a handle can cache for its event callbacks.
+#define IOTJS_UV_HANDLE_SLOTS 2
+
 typedef struct {
   jerry_value_t jobject;
   OnCloseHandler on_close_cb;
+  // Values of the properties bound by IOTJS_UV_HANDLE_SLOT_ACCESSORS.
+  jerry_value_t jslots[IOTJS_UV_HANDLE_SLOTS];
 } iotjs_uv_handle_data;
 
 #define IOTJS_ALIGNUP(value, alignment) \
@@ -53,6 +58,9 @@ uv_handle_t* iotjs_uv_handle_create(size_t handle_size,
                                     JNativeInfoType* native_info,
                                     size_t extra_data_size);
 void iotjs_uv_handle_close(uv_handle_t* handle, OnCloseHandler close_handler);
+// Releases the memory of a handle that is not closed by
+// iotjs_uv_handle_close.
+void iotjs_uv_handle_free(uv_handle_t* handle);
 
 /**
  * Returns a pointer to the handle data struct referenced
@@ -71,5 +79,39 @@ void iotjs_uv_handle_close(uv_handle_t* handle, OnCloseHandler close_handler);
 #define IOTJS_UV_HANDLE_EXTRA_DATA(UV_HANDLE) \
   ((char*)((char*)((UV_HANDLE)->data) + sizeof(iotjs_uv_handle_data)))
 
+/**
+ * Returns the value cached in the given slot of the handle, without
+ * acquiring it.
+ */
+#define IOTJS_UV_HANDLE_SLOT(UV_HANDLE, SLOT) \
+  (IOTJS_UV_HANDLE_DATA(UV_HANDLE)->jslots[SLOT])
+
+void iotjs_uv_handle_set_slot(uv_handle_t* handle, size_t slot,
+                              jerry_value_t value);
+
+/**
+ * Defines the `NAME_get` and `NAME_set` accessor functions of a property
+ * whose value is kept in the given slot of the handle. Event callbacks can
+ * then use the value directly instead of looking up the property by name.
+ * The accessors are registered on the prototype with
+ * iotjs_jval_set_accessor.
+ *
+ * IMPORTANT!
+ * This must be used in the module that defines `this_module_native_info`
+ * for the handle.
+ */
+#define IOTJS_UV_HANDLE_SLOT_ACCESSORS(NAME, SLOT)                     \
+  JS_FUNCTION(NAME##_get) {                                            \
+    JS_DECLARE_PTR(jthis, uv_handle_t, handle);                        \
+    return jerry_acquire_value(IOTJS_UV_HANDLE_SLOT(handle, SLOT));    \
+  }                                                                    \
+  JS_FUNCTION(NAME##_set) {                                            \
+    JS_DECLARE_PTR(jthis, uv_handle_t, handle);                        \
+    iotjs_uv_handle_set_slot(handle, SLOT,                             \
+                             jargc > 0 ? jargv[0]                      \
+                                       : jerry_create_undefined());    \
+    return jerry_create_undefined();                                   \
+  }
+
 
 #endif /* IOTJS_UV_HANDLE */
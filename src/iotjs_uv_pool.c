@@ -0,0 +1,226 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "iotjs_def.h"
+
+#include "iotjs_uv_pool.h"
+
+
+#ifndef IOTJS_UV_POOL_MAX_BYTES
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_UV_POOL_MAX_BYTES (8 * 1024)
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_UV_POOL_MAX_BYTES (64 * 1024)
+#endif /* __NUTTX__ || __TIZENRT__ */
+#endif /* IOTJS_UV_POOL_MAX_BYTES */
+
+#define IOTJS_UV_POOL_MAX_SIZE 1024
+#define IOTJS_UV_POOL_CLASS_COUNT 12
+// Sizes are rounded up to this granularity to merge nearly equal classes.
+#define IOTJS_UV_POOL_GRANULARITY 16u
+
+
+// Stored in front of every block, keeps the payload 8 byte aligned.
+typedef struct {
+  uint32_t kind;
+  // Index of the class, or -1 for blocks of the system allocator.
+  int32_t class_index;
+} uv_pool_header_t;
+
+typedef struct uv_pool_block_s {
+  struct uv_pool_block_s* next;
+} uv_pool_block_t;
+
+typedef struct {
+  size_t size;
+  uv_pool_block_t* free_list;
+  uint32_t live;
+  uint32_t pooled;
+  uint32_t hits;
+  uint32_t misses;
+} uv_pool_class_t;
+
+typedef struct {
+  uv_pool_class_t classes[IOTJS_UV_POOL_CLASS_COUNT];
+  uint32_t class_count;
+  uint32_t large_live;
+} uv_pool_t;
+
+static uv_pool_t uv_pools[kUvPoolCount];
+static size_t uv_pool_pooled_bytes;
+
+
+static int uv_pool_class_index(uv_pool_t* pool, size_t size) {
+  if (size > IOTJS_UV_POOL_MAX_SIZE) {
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < pool->class_count; i++) {
+    if (pool->classes[i].size == size) {
+      return (int)i;
+    }
+  }
+
+  if (pool->class_count == IOTJS_UV_POOL_CLASS_COUNT) {
+    return -1;
+  }
+
+  pool->classes[pool->class_count].size = size;
+  return (int)pool->class_count++;
+}
+
+
+void* iotjs_uv_pool_alloc(iotjs_uv_pool_kind_t kind, size_t size) {
+  IOTJS_ASSERT(kind < kUvPoolCount);
+
+  uv_pool_t* pool = &uv_pools[kind];
+  size = (size + IOTJS_UV_POOL_GRANULARITY - 1) &
+         ~(size_t)(IOTJS_UV_POOL_GRANULARITY - 1);
+
+  int index = uv_pool_class_index(pool, size);
+  uv_pool_header_t* header;
+
+  if (index < 0) {
+    pool->large_live++;
+    header = (uv_pool_header_t*)iotjs_buffer_allocate_uninitialized(
+        sizeof(uv_pool_header_t) + size);
+  } else {
+    uv_pool_class_t* pool_class = &pool->classes[index];
+    pool_class->live++;
+
+    if (pool_class->free_list != NULL) {
+      uv_pool_block_t* block = pool_class->free_list;
+      pool_class->free_list = block->next;
+      pool_class->pooled--;
+      pool_class->hits++;
+      uv_pool_pooled_bytes -= size;
+      header = (uv_pool_header_t*)block - 1;
+    } else {
+      pool_class->misses++;
+      header = (uv_pool_header_t*)iotjs_buffer_allocate_uninitialized(
+          sizeof(uv_pool_header_t) + size);
+    }
+  }
+
+  header->kind = (uint32_t)kind;
+  header->class_index = index;
+
+  void* memory = header + 1;
+  memset(memory, 0, size);
+  return memory;
+}
+
+
+void iotjs_uv_pool_free(void* memory) {
+  if (memory == NULL) {
+    return;
+  }
+
+  uv_pool_header_t* header = (uv_pool_header_t*)memory - 1;
+  IOTJS_ASSERT(header->kind < kUvPoolCount);
+  uv_pool_t* pool = &uv_pools[header->kind];
+
+  if (header->class_index < 0) {
+    pool->large_live--;
+    IOTJS_RELEASE(header);
+    return;
+  }
+
+  uv_pool_class_t* pool_class = &pool->classes[header->class_index];
+  pool_class->live--;
+
+  if (uv_pool_pooled_bytes + pool_class->size > IOTJS_UV_POOL_MAX_BYTES) {
+    IOTJS_RELEASE(header);
+    return;
+  }
+
+  uv_pool_block_t* block = (uv_pool_block_t*)memory;
+  block->next = pool_class->free_list;
+  pool_class->free_list = block;
+  pool_class->pooled++;
+  uv_pool_pooled_bytes += pool_class->size;
+}
+
+
+static jerry_value_t uv_pool_stats(uv_pool_t* pool) {
+  jerry_value_t jstats = jerry_create_object();
+  jerry_value_t jclasses = jerry_create_array(pool->class_count);
+
+  for (uint32_t i = 0; i < pool->class_count; i++) {
+    uv_pool_class_t* pool_class = &pool->classes[i];
+    jerry_value_t jclass = jerry_create_object();
+
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_SIZE,
+                                   pool_class->size);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_LIVE,
+                                   pool_class->live);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_POOLED,
+                                   pool_class->pooled);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_HITS,
+                                   pool_class->hits);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_MISSES,
+                                   pool_class->misses);
+
+    iotjs_jval_set_property_by_index(jclasses, i, jclass);
+    jerry_release_value(jclass);
+  }
+
+  iotjs_jval_set_property_jval(jstats, IOTJS_MAGIC_STRING_CLASSES, jclasses);
+  jerry_release_value(jclasses);
+
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_LARGELIVE,
+                                 pool->large_live);
+
+  return jstats;
+}
+
+
+jerry_value_t iotjs_uv_pool_stats(void) {
+  jerry_value_t jstats = jerry_create_object();
+
+  jerry_value_t jhandles = uv_pool_stats(&uv_pools[kUvPoolHandle]);
+  iotjs_jval_set_property_jval(jstats, IOTJS_MAGIC_STRING_HANDLES, jhandles);
+  jerry_release_value(jhandles);
+
+  jerry_value_t jrequests = uv_pool_stats(&uv_pools[kUvPoolRequest]);
+  iotjs_jval_set_property_jval(jstats, IOTJS_MAGIC_STRING_REQUESTS, jrequests);
+  jerry_release_value(jrequests);
+
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_POOLEDBYTES,
+                                 uv_pool_pooled_bytes);
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_MAXPOOLEDBYTES,
+                                 IOTJS_UV_POOL_MAX_BYTES);
+
+  return jstats;
+}
+
+
+void iotjs_uv_pool_cleanup(void) {
+  for (int kind = 0; kind < kUvPoolCount; kind++) {
+    uv_pool_t* pool = &uv_pools[kind];
+
+    for (uint32_t i = 0; i < pool->class_count; i++) {
+      uv_pool_class_t* pool_class = &pool->classes[i];
+
+      while (pool_class->free_list != NULL) {
+        uv_pool_block_t* block = pool_class->free_list;
+        pool_class->free_list = block->next;
+        iotjs_buffer_release((char*)((uv_pool_header_t*)block - 1));
+      }
+      pool_class->pooled = 0;
+    }
+  }
+  uv_pool_pooled_bytes = 0;
+}
@@ -0,0 +1,47 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IOTJS_UV_POOL_H
+#define IOTJS_UV_POOL_H
+
+#include "iotjs_binding.h"
+
+/**
+ * Memory of uv handles and requests is recycled through free lists.
+ *
+ * Every allocation size, which is the same for all objects of a handle or
+ * request type, gets its own class on first use. Released blocks are kept
+ * in the free list of their class, as long as the pooled memory of all
+ * classes stays below IOTJS_UV_POOL_MAX_BYTES. Blocks larger than
+ * IOTJS_UV_POOL_MAX_SIZE, or allocated when all classes are taken, go
+ * directly to the system allocator.
+ *
+ * The returned memory is zero filled.
+ */
+typedef enum {
+  kUvPoolHandle = 0,
+  kUvPoolRequest,
+  kUvPoolCount
+} iotjs_uv_pool_kind_t;
+
+void* iotjs_uv_pool_alloc(iotjs_uv_pool_kind_t kind, size_t size);
+void iotjs_uv_pool_free(void* memory);
+
+// Returns an object with the counters of the pools.
+jerry_value_t iotjs_uv_pool_stats(void);
+
+void iotjs_uv_pool_cleanup(void);
+
+#endif /* IOTJS_UV_POOL_H */
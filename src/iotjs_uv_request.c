@@ -16,6 +16,7 @@
 #include "iotjs_uv_request.h"
 
 #include "iotjs_def.h"
+#include "iotjs_uv_pool.h"
 
 /**
  * Aligns @a value to @a alignment. @a must be the power of 2.
@@ -35,7 +36,8 @@ uv_req_t* iotjs_uv_request_create(size_t request_size,
   /* Make sure that the jerry_value_t is aligned */
   size_t aligned_request_size = IOTJS_ALIGNUP(request_size, 8u);
 
-  char* request_memory = iotjs_buffer_allocate(
+  char* request_memory = (char*)iotjs_uv_pool_alloc(
+      kUvPoolRequest,
       aligned_request_size + sizeof(jerry_value_t) + extra_data_size);
   uv_req_t* uv_request = (uv_req_t*)request_memory;
   uv_request->data = request_memory + aligned_request_size;
@@ -49,5 +51,5 @@ uv_req_t* iotjs_uv_request_create(size_t request_size,
 
 void iotjs_uv_request_destroy(uv_req_t* request) {
   jerry_release_value(*IOTJS_UV_REQUEST_JSCALLBACK(request));
-  IOTJS_RELEASE(request);
+  iotjs_uv_pool_free(request);
 }
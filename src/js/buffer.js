@@ -22,6 +22,12 @@ function checkInt(buffer, value, offset, ext, max, min) {
 }
 
 
+function checkValue(value, max, min) {
+  if (value > max || value < min)
+    throw new TypeError('value is out of bounds');
+}
+
+
 function checkOffset(offset, ext, length) {
   if (offset + ext > length)
     throw new RangeError('index out of range');
@@ -62,7 +68,9 @@ function Buffer(subject, encoding) {
   }
 
   // 'native' is the buffer object created via the C API.
-  native(this, this.length);
+  // Buffer and Array subjects overwrite every byte, so zero filling the
+  // storage can be skipped for them.
+  native(this, this.length, typeof subject === 'object');
 
   if (typeof subject === 'string') {
     if (typeof encoding === 'string') {
@@ -112,29 +120,40 @@ Buffer.byteLength = function(str, encoding) {
 };
 
 
-// Buffer.concat(list)
-Buffer.concat = function(list) {
+// Buffer.concat(list[, totalLength])
+// * When totalLength is given, the result is truncated or zero filled to
+//   that length.
+Buffer.concat = function(list, totalLength) {
   if (!Array.isArray(list)) {
     throw new TypeError('Bad arguments: Buffer.concat([Buffer])');
   }
 
-  var length = 0;
-  var i;
-  for (i = 0; i < list.length; ++i) {
-    if (!Buffer.isBuffer(list[i])) {
-      throw new TypeError('Bad arguments: Buffer.concat([Buffer])');
+  if (totalLength !== undefined) {
+    if (typeof totalLength !== 'number') {
+      throw new TypeError('Bad arguments: Buffer.concat([Buffer], number)');
     }
-    length += list[i].length;
+    totalLength = totalLength > 0 ? totalLength >>> 0 : 0;
   }
 
-  var buffer = new Buffer(length);
-  var pos = 0;
-  for (i = 0; i < list.length; ++i) {
-    list[i].copy(buffer, pos);
-    pos += list[i].length;
+  return native.concat(list, totalLength);
+};
+
+
+// Buffer.allocUnsafe(size)
+// * The content of the returned buffer is not initialized.
+Buffer.allocUnsafe = function(size) {
+  if (typeof size !== 'number') {
+    throw new TypeError('Bad arguments: Buffer.allocUnsafe(number)');
   }
 
-  return buffer;
+  return native.allocUnsafe(size > 0 ? size >>> 0 : 0);
+};
+
+
+// Buffer.poolStats()
+// * Returns the statistics of the allocator of the buffer storage.
+Buffer.poolStats = function() {
+  return native.poolStats();
 };
 
 
@@ -268,33 +287,54 @@ Buffer.prototype.writeUInt8 = function(value, offset, noAssert) {
 
 
 // buff.writeUInt16LE(value, offset[,noAssert])
+// buff.writeUInt16BE(value, offset[,noAssert])
+// buff.writeInt16LE(value, offset[,noAssert])
+// buff.writeInt16BE(value, offset[,noAssert])
+// buff.writeUInt32LE(value, offset[,noAssert])
+// buff.writeUInt32BE(value, offset[,noAssert])
+// buff.writeInt32LE(value, offset[,noAssert])
+// buff.writeInt32BE(value, offset[,noAssert])
 // [1] buff.writeUInt16LE(value, offset)
 // [2] buff.writeUInt16LE(value, offset, noAssert)
-Buffer.prototype.writeUInt16LE = function(value, offset, noAssert) {
-  value = +value;
-  offset = offset >>> 0;
-  if (!noAssert)
-    checkInt(this, value, offset, 2, 0xffff, 0);
-  native.writeUInt8(this, value & 0xff, offset);
-  native.writeUInt8(this, (value >>> 8) & 0xff, offset + 1);
-  return offset + 2;
-};
+// * The offset is validated by the native side, with noAssert the bytes
+//   outside of the buffer are not written.
+function defineWriteInt(name, max, min) {
+  var write = native[name];
+  Buffer.prototype[name] = function(value, offset, noAssert) {
+    value = +value;
+    if (!noAssert)
+      checkValue(value, max, min);
+    return write(this, value, offset >>> 0, !!noAssert);
+  };
+}
 
+defineWriteInt('writeUInt16LE', 0xffff, 0);
+defineWriteInt('writeUInt16BE', 0xffff, 0);
+defineWriteInt('writeInt16LE', 0x7fff, -0x8000);
+defineWriteInt('writeInt16BE', 0x7fff, -0x8000);
+defineWriteInt('writeUInt32LE', -1 >>> 0, 0);
+defineWriteInt('writeUInt32BE', -1 >>> 0, 0);
+defineWriteInt('writeInt32LE', 0x7fffffff, -0x80000000);
+defineWriteInt('writeInt32BE', 0x7fffffff, -0x80000000);
+
+
+// buff.writeFloatLE(value, offset[,noAssert])
+// buff.writeFloatBE(value, offset[,noAssert])
+// buff.writeDoubleLE(value, offset[,noAssert])
+// buff.writeDoubleBE(value, offset[,noAssert])
+// [1] buff.writeFloatLE(value, offset)
+// [2] buff.writeFloatLE(value, offset, noAssert)
+function defineWriteFloat(name) {
+  var write = native[name];
+  Buffer.prototype[name] = function(value, offset, noAssert) {
+    return write(this, +value, offset >>> 0, !!noAssert);
+  };
+}
 
-// buff.writeUInt32LE(value, offset[,noAssert])
-// [1] buff.writeUInt32LE(value, offset)
-// [2] buff.writeUInt32LE(value, offset, noAssert)
-Buffer.prototype.writeUInt32LE = function(value, offset, noAssert) {
-  value = +value;
-  offset = offset >>> 0;
-  if (!noAssert)
-    checkInt(this, value, offset, 4, -1 >>> 0, 0);
-  native.writeUInt8(this, (value >>> 24) & 0xff, offset + 3);
-  native.writeUInt8(this, (value >>> 16) & 0xff, offset + 2);
-  native.writeUInt8(this, (value >>> 8) & 0xff, offset + 1);
-  native.writeUInt8(this, value & 0xff, offset);
-  return offset + 4;
-};
+defineWriteFloat('writeFloatLE');
+defineWriteFloat('writeFloatBE');
+defineWriteFloat('writeDoubleLE');
+defineWriteFloat('writeDoubleBE');
 
 
 // buff.readUInt8(offset[,noAssert])
@@ -321,26 +361,108 @@ Buffer.prototype.readInt8 = function(offset, noAssert) {
 
 
 // buff.readUInt16LE(offset[,noAssert])
+// buff.readUInt16BE(offset[,noAssert])
+// buff.readInt16LE(offset[,noAssert])
+// buff.readInt16BE(offset[,noAssert])
+// buff.readUInt32LE(offset[,noAssert])
+// buff.readUInt32BE(offset[,noAssert])
+// buff.readInt32LE(offset[,noAssert])
+// buff.readInt32BE(offset[,noAssert])
+// buff.readFloatLE(offset[,noAssert])
+// buff.readFloatBE(offset[,noAssert])
+// buff.readDoubleLE(offset[,noAssert])
+// buff.readDoubleBE(offset[,noAssert])
 // [1] buff.readUInt16LE(offset)
 // [2] buff.readUInt16LE(offset, noAssert)
-Buffer.prototype.readUInt16LE = function(offset, noAssert) {
-  offset = offset >>> 0;
-  if (!noAssert)
-    checkOffset(offset, 2, this.length);
-  return native.readUInt8(this, offset) |
-         (native.readUInt8(this, offset + 1) << 8);
+// * The offset is validated by the native side, with noAssert the bytes
+//   outside of the buffer are read as zeros.
+function defineRead(name) {
+  var read = native[name];
+  Buffer.prototype[name] = function(offset, noAssert) {
+    return read(this, offset >>> 0, !!noAssert);
+  };
+}
+
+defineRead('readUInt16LE');
+defineRead('readUInt16BE');
+defineRead('readInt16LE');
+defineRead('readInt16BE');
+defineRead('readUInt32LE');
+defineRead('readUInt32BE');
+defineRead('readInt32LE');
+defineRead('readInt32BE');
+defineRead('readFloatLE');
+defineRead('readFloatBE');
+defineRead('readDoubleLE');
+defineRead('readDoubleBE');
+
+
+// buff.fill(value[, start[, end]])
+// [1] buff.fill(value)
+// [2] buff.fill(value, start)
+// [3] buff.fill(value, start, end)
+// * value - number, string or Buffer
+// * start - default to 0
+// * end - default to buff.length
+Buffer.prototype.fill = function(value, start, end) {
+  if (typeof value !== 'string' && !Buffer.isBuffer(value)) {
+    value = +value || 0;
+  }
+
+  start = start === undefined ? 0 : ~~start;
+  end = end === undefined ? this.length : ~~end;
+
+  native.fill(this, value, start, end);
+  return this;
 };
 
 
-// buff.fill(value)
-Buffer.prototype.fill = function(value) {
+// buff.indexOf(value[, byteOffset][, encoding])
+// buff.lastIndexOf(value[, byteOffset][, encoding])
+// buff.includes(value[, byteOffset][, encoding])
+// * value - number, string or Buffer
+// * byteOffset - where to begin searching, negative values count from the
+//   end. Default to 0, or to buff.length for lastIndexOf
+// * encoding - encoding of a string value, default to utf8
+function indexOf(buffer, value, byteOffset, encoding, last) {
+  if (typeof byteOffset === 'string') {
+    encoding = byteOffset;
+    byteOffset = undefined;
+  }
+
   if (typeof value === 'number') {
-    value = value & 255;
-    for (var i = 0; i < this.length; i++) {
-      native.writeUInt8(this, value, i);
+    value = value & 0xff;
+  } else if (typeof value === 'string') {
+    if (getEncodingType(encoding) !== -1) {
+      value = new Buffer(value, encoding);
     }
+  } else if (!Buffer.isBuffer(value)) {
+    throw new TypeError('Bad arguments: buff.indexOf(number|string|Buffer)');
   }
-  return this;
+
+  byteOffset = +byteOffset;
+  if (isNaN(byteOffset)) {
+    byteOffset = last ? buffer.length : 0;
+  } else if (byteOffset < 0) {
+    byteOffset += buffer.length;
+  }
+
+  return native.indexOf(buffer, value, byteOffset, last);
+}
+
+
+Buffer.prototype.indexOf = function(value, byteOffset, encoding) {
+  return indexOf(this, value, byteOffset, encoding, false);
+};
+
+
+Buffer.prototype.lastIndexOf = function(value, byteOffset, encoding) {
+  return indexOf(this, value, byteOffset, encoding, true);
+};
+
+
+Buffer.prototype.includes = function(value, byteOffset, encoding) {
+  return indexOf(this, value, byteOffset, encoding, false) !== -1;
 };
 
 
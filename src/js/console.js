@@ -33,5 +33,36 @@ Console.prototype.error = function() {
 };
 
 
+// Writes the output from a separate thread instead of blocking the caller.
+// `options.queueSize` bytes are queued per stream, messages which do not fit
+// are dropped, or wait for room if `options.overflow` is 'block'.
+Console.prototype.setAsync = function(enable, options) {
+  options = options || {};
+
+  var queueSize = options.queueSize;
+  if (queueSize === undefined) {
+    queueSize = 0;
+  } else if (!util.isNumber(queueSize) || Math.floor(queueSize) !== queueSize ||
+             queueSize < 1 || queueSize > native.MAX_QUEUE_SIZE) {
+    throw new RangeError('queueSize must be an integer between 1 and ' +
+                         native.MAX_QUEUE_SIZE);
+  }
+
+  var overflow = options.overflow || 'drop';
+  if (overflow !== 'drop' && overflow !== 'block') {
+    throw new TypeError('overflow must be \'drop\' or \'block\'');
+  }
+
+  if (!native.setAsync(!!enable, queueSize, overflow === 'block')) {
+    throw new Error('Failed to start the console writer');
+  }
+};
+
+
+Console.prototype.asyncStats = function() {
+  return native.asyncStats();
+};
+
+
 module.exports = new Console();
 module.exports.Console = Console;
@@ -21,6 +21,9 @@ var BIND_STATE_UNBOUND = 0;
 var BIND_STATE_BINDING = 1;
 var BIND_STATE_BOUND = 2;
 
+// Upper limit of the `recvBatchSize` option.
+var MAX_RECV_BATCH_SIZE = 256;
+
 // lazily loaded
 var dns = null;
 
@@ -69,6 +72,20 @@ function Socket(type, listener) {
   // If true - UV_UDP_REUSEADDR flag will be set
   this._reuseAddr = options && options.reuseAddr;
 
+  // Datagrams received together are passed to JavaScript at once.
+  this._recvBatchSize = 1;
+  if (options && options.recvBatchSize !== undefined) {
+    var batchSize = options.recvBatchSize;
+    if (!util.isNumber(batchSize) || batchSize % 1 !== 0) {
+      throw new TypeError('recvBatchSize must be an integer');
+    }
+    if (batchSize < 1 || batchSize > MAX_RECV_BATCH_SIZE) {
+      throw new RangeError('recvBatchSize must be between 1 and ' +
+                           MAX_RECV_BATCH_SIZE);
+    }
+    this._recvBatchSize = batchSize;
+  }
+
   if (util.isFunction(listener))
     this.on('message', listener);
 }
@@ -82,8 +99,11 @@ exports.createSocket = function(type, listener) {
 
 function startListening(socket) {
   socket._handle.onmessage = onMessage;
+  if (socket._recvBatchSize > 1) {
+    socket._handle.onmessages = onMessages;
+  }
   // Todo: handle errors
-  socket._handle.recvStart();
+  socket._handle.recvStart(socket._recvBatchSize);
   socket._receiving = true;
   socket._bindState = BIND_STATE_BOUND;
   socket.fd = -42; // compatibility hack
@@ -315,6 +335,135 @@ function doSend(ex, self, ip, list, address, port, callback) {
 }
 
 
+// Largest number of datagrams of a sendBatch() call.
+var MAX_SEND_BATCH_SIZE = 1024;
+
+
+Socket.prototype.sendBatch = function(messages, callback) {
+  var self = this;
+
+  if (!util.isArray(messages))
+    throw new TypeError('First argument must be an array');
+
+  var count = messages.length;
+  if (count === 0 || count > MAX_SEND_BATCH_SIZE)
+    throw new RangeError('Batch must have between 1 and ' +
+                         MAX_SEND_BATCH_SIZE + ' messages');
+
+  var buffers = new Array(count);
+  var ports = new Array(count);
+  var addresses = new Array(count);
+
+  for (var i = 0; i < count; i++) {
+    var message = messages[i];
+    if (!util.isObject(message))
+      throw new TypeError('Batch messages must be objects');
+
+    var buf = message.buf;
+    if (util.isString(buf))
+      buf = new Buffer(buf);
+    else if (!util.isBuffer(buf))
+      throw new TypeError('Message buf must be a buffer or a string');
+
+    var port = message.port >>> 0;
+    if (port === 0 || port > 65535)
+      throw new RangeError('Port should be > 0 and < 65536');
+
+    buffers[i] = buf;
+    ports[i] = port;
+    addresses[i] = message.address;
+  }
+
+  if (!(util.isFunction(callback)))
+    callback = undefined;
+
+  self._healthCheck();
+
+  if (self._bindState === BIND_STATE_UNBOUND)
+    self.bind(0, null);
+
+  if (self._bindState !== BIND_STATE_BOUND) {
+    enqueue(self, function() {
+      lookupBatch(self, buffers, ports, addresses, callback);
+    });
+    return;
+  }
+
+  lookupBatch(self, buffers, ports, addresses, callback);
+};
+
+
+// Resolves every distinct address of the batch once, then sends it.
+function lookupBatch(self, buffers, ports, addresses, callback) {
+  var ips = {};
+  var pending = 1;
+  var failed = false;
+
+  function resolved() {
+    if (--pending > 0)
+      return;
+
+    var list = new Array(addresses.length);
+    for (var i = 0; i < addresses.length; i++)
+      list[i] = ips[addresses[i]];
+    doSendBatch(null, self, buffers, ports, list, callback);
+  }
+
+  function afterDns(address, ex, ip) {
+    if (failed)
+      return;
+
+    if (ex) {
+      failed = true;
+      doSendBatch(ex, self, buffers, ports, null, callback);
+      return;
+    }
+
+    ips[address] = ip;
+    resolved();
+  }
+
+  for (var i = 0; i < addresses.length; i++) {
+    var address = addresses[i];
+    if (!ips.hasOwnProperty(address)) {
+      ips[address] = null;
+      pending++;
+      self._handle.lookup(address, afterDns.bind(null, address));
+    }
+  }
+
+  resolved();
+}
+
+
+function doSendBatch(ex, self, buffers, ports, ips, callback) {
+  if (ex) {
+    if (util.isFunction(callback)) {
+      callback(ex);
+      return;
+    }
+
+    self.emit('error', ex);
+    return;
+  } else if (!self._handle) {
+    return;
+  }
+
+  var err = self._handle.sendBatch(buffers, ports, ips,
+                                   function(err, length) {
+    err = err ? util.errnoException(err, 'send') : null;
+
+    if (util.isFunction(callback)) {
+      callback(err, length);
+    }
+  });
+
+  if (err && callback) {
+    process.nextTick(callback, util.errnoException(err, 'send'));
+  }
+}
+
+
 Socket.prototype.close = function(callback) {
   if (util.isFunction(callback))
     this.on('close', callback);
@@ -464,6 +613,56 @@ function onMessage(nread, handle, buf, rinfo) {
 }
 
 
+// Datagrams received in one batch. They are stored one after the other in
+// `buffer`, datagram `i` is between `offsets[i]` and `offsets[i + 1]`.
+function MessageBatch(buffer, offsets, addresses) {
+  this.buffer = buffer;
+  this.offsets = offsets;
+  this.length = offsets.length - 1;
+  this._addresses = addresses;
+}
+
+
+MessageBatch.prototype.message = function(index) {
+  return this.buffer.slice(this.offsets[index], this.offsets[index + 1]);
+};
+
+
+// The sender of every datagram takes six bytes of `addresses`: the IPv4
+// address and the port in network byte order.
+MessageBatch.prototype.rinfo = function(index) {
+  var addresses = this._addresses;
+  var start = index * 6;
+
+  return {
+    address: addresses[start] + '.' + addresses[start + 1] + '.' +
+             addresses[start + 2] + '.' + addresses[start + 3],
+    family: 'IPv4',
+    port: (addresses[start + 4] << 8) | addresses[start + 5],
+    size: this.offsets[index + 1] - this.offsets[index]
+  };
+};
+
+
+function onMessages(handle, buf, offsets, addresses) {
+  var self = handle.owner;
+  if (!self._handle) {
+    return;
+  }
+
+  var batch = new MessageBatch(buf, offsets, addresses);
+
+  if (self._events && self._events.messages) {
+    self.emit('messages', batch);
+    return;
+  }
+
+  for (var i = 0; i < batch.length && self._handle; i++) {
+    self.emit('message', batch.message(i), batch.rinfo(i));
+  }
+}
+
+
 /*
 TODO: Implement Socket.prototype.ref.
 
@@ -176,6 +176,7 @@ fs.readFile = function(path, callback) {
 
   var fd;
   var buffers;
+  var totalLength = 0;
 
   fs.open(path, 'r', function(err, _fd) {
     if (err) {
@@ -208,13 +209,14 @@ fs.readFile = function(path, callback) {
     } else {
       // continue reading.
       buffers.push(buffer.slice(0, bytesRead));
+      totalLength += bytesRead;
       read();
     }
   };
 
   var close = function() {
     fs.close(fd, function(err) {
-      return callback(err, Buffer.concat(buffers));
+      return callback(err, Buffer.concat(buffers, totalLength));
     });
   };
 };
@@ -225,6 +227,7 @@ fs.readFileSync = function(path) {
 
   var fd = fs.openSync(path, 'r', 438);
   var buffers = [];
+  var totalLength = 0;
 
   while (true) {
     try {
@@ -232,6 +235,7 @@ fs.readFileSync = function(path) {
       var bytesRead = fs.readSync(fd, buffer, 0, 1023);
       if (bytesRead) {
         buffers.push(buffer.slice(0, bytesRead));
+        totalLength += bytesRead;
       } else {
         break;
       }
@@ -241,7 +245,7 @@ fs.readFileSync = function(path) {
   }
   fs.closeSync(fd);
 
-  return Buffer.concat(buffers);
+  return Buffer.concat(buffers, totalLength);
 };
 
 
@@ -449,8 +453,12 @@ try {
         // null must be pushed so the 'end' event will be emitted.
         self.push(null);
       } else {
-        self.push(bytes_read == self._buff.length ?
-                  self._buff : self._buff.slice(0, bytes_read));
+        // The pushed chunk (or a slice of it) is handed over to the
+        // consumer, so the next read needs its own buffer.
+        var buff = self._buff;
+        self._buff = new Buffer(buff.length);
+        self.push(bytes_read == buff.length ?
+                  buff : buff.slice(0, bytes_read));
         self.doRead();
       }
     });
@@ -74,7 +74,8 @@ ClientRequest.prototype.end = function(data, encoding, callback) {
 
 function setupConnection(req) {
   var socket = req.socket;
-  var parser = common.createHTTPParser(HTTPParser.RESPONSE);
+  var parser = common.createHTTPParser(HTTPParser.RESPONSE,
+                                       req.options.lazyHeaders);
   socket.parser = parser;
   socket._httpMessage = req;
 
@@ -86,7 +87,17 @@ function setupConnection(req) {
   req.parser = parser;
 
   socket.on('error', socketOnError);
-  socket.on('data', socketOnData);
+  if (req.options.nativeParsing) {
+    // The handle of the socket exists once it is connected.
+    socket.once('connect', function() {
+      if (socket.parser === parser &&
+          !common.consumeSocket(parser, socket, parserOnExecuteError)) {
+        socket.on('data', socketOnData);
+      }
+    });
+  } else {
+    socket.on('data', socketOnData);
+  }
   socket.on('end', socketOnEnd);
   socket.on('close', socketOnClose);
 
@@ -101,10 +112,8 @@ function cleanUpSocket(socket) {
   var req = socket._httpMessage;
 
   if (parser) {
-    // unref all links to parser, make parser GCed
     parser.finish();
-    parser = null;
-    socket.parser = null;
+    common.freeParser(parser, socket);
     req.parser = null;
   }
 
@@ -158,6 +167,15 @@ function socketOnData(d) {
   }
 }
 
+// Parse error of a consumed socket.
+function parserOnExecuteError(err) {
+  var socket = this.socket;
+  var req = socket._httpMessage;
+
+  cleanUpSocket(socket);
+  req.emit('error', err);
+}
+
 function socketOnEnd() {
   cleanUpSocket(this);
 }
@@ -17,17 +17,67 @@ var util = require('util');
 var IncomingMessage = require('http_incoming').IncomingMessage;
 var HTTPParser = require('http_parser').HTTPParser;
 
-exports.createHTTPParser = function(type) {
-  var parser = new HTTPParser(type);
-  // cb during  http parsing from C side(http_parser)
-  parser.OnHeaders = parserOnHeaders;
-  parser.OnHeadersComplete = parserOnHeadersComplete;
-  parser.OnBody = parserOnBody;
-  parser.OnMessageComplete = parserOnMessageComplete;
+// Parsers of closed connections, reused by new connections.
+var freeParsers = [];
+var MAX_FREE_PARSERS = 8;
+
+// With `lazyHeaders` the headers are passed as raw bytes and decoded when
+// `IncomingMessage.headers` is first accessed.
+exports.createHTTPParser = function(type, lazyHeaders) {
+  var parser = freeParsers.pop();
+  lazyHeaders = !!lazyHeaders;
+
+  if (parser) {
+    parser.reinitialize(type, lazyHeaders);
+  } else {
+    parser = new HTTPParser(type, lazyHeaders);
+    // cb during  http parsing from C side(http_parser)
+    parser.OnHeaders = parserOnHeaders;
+    parser.OnHeadersComplete = parserOnHeadersComplete;
+    parser.OnBody = parserOnBody;
+    parser.OnMessageComplete = parserOnMessageComplete;
+  }
+
   parser._IncomingMessage = IncomingMessage;
   return parser;
 };
 
+// Lets the parser take the data of the socket straight from its TCP handle,
+// so only parsed headers, body slices and message ends reach JS. The socket
+// emits no 'data' events then. `onError` is called with the parse error.
+// Returns false if the socket has no TCP handle to consume, e.g. with TLS.
+exports.consumeSocket = function(parser, socket, onError) {
+  // NuttX sockets need the EOF handling of the 'data' path.
+  if (process.platform === 'nuttx' || !parser.consume(socket._handle)) {
+    return false;
+  }
+
+  parser.OnExecuteError = onError;
+  return true;
+};
+
+// Detaches the parser from its connection and keeps it for a new one. A
+// parser freed by one of its own callbacks, e.g. by `req.abort()` in a
+// 'response' handler, is not kept: a new request could reinitialize it
+// while it still parses the rest of the old message.
+exports.freeParser = function(parser, socket) {
+  parser.unconsume();
+  parser.OnExecuteError = undefined;
+  parser.socket = null;
+  parser.incoming = null;
+  parser.onIncoming = null;
+  parser._headers = [];
+  parser._url = '';
+
+  if (socket) {
+    socket.parser = null;
+  }
+
+  if (freeParsers.length < MAX_FREE_PARSERS && !parser.isExecuting()) {
+    freeParsers.push(parser);
+  }
+};
+
 // This is called when parsing of incoming http msg done
 function parserOnMessageComplete() {
   var stream = this.incoming;
@@ -53,7 +103,7 @@ function parserOnHeadersComplete(info) {
     this.url = '';
   }
 
-  if (!headers) {
+  if (!headers && !info.rawHeaders) {
     headers = this._headers;
     this._headers = [];
   }
@@ -64,7 +114,11 @@ function parserOnHeadersComplete(info) {
   this.incoming.httpVersion = info.http_major + '.' + info.http_minor;
 
   // add header fields of headers to incoming.headers
-  this.incoming.addHeaders(headers);
+  if (info.rawHeaders) {
+    this.incoming.setRawHeaders(info.rawHeaders, info.rawHeaderOffsets);
+  } else {
+    this.incoming.addHeaders(headers);
+  }
 
   if (util.isNumber(info.method)) {
     // for server
@@ -24,6 +24,8 @@ function IncomingMessage(socket) {
 
   this.readable = true;
 
+  this._rawHeaders = null;
+  this._rawHeaderOffsets = null;
   this.headers = {};
 
   this.complete = false;
@@ -62,6 +64,51 @@ IncomingMessage.prototype.addHeaders = function(headers) {
 };
 
 
+// Headers received as raw bytes are decoded on first access.
+Object.defineProperty(IncomingMessage.prototype, 'headers', {
+  get: function() {
+    if (this._rawHeaders) {
+      this._decodeRawHeaders();
+    }
+    return this._headerObject;
+  },
+  set: function(headers) {
+    this._rawHeaders = null;
+    this._rawHeaderOffsets = null;
+    this._headerObject = headers;
+  },
+  enumerable: true,
+  configurable: true
+});
+
+
+// Name `i` is between `offsets[2 * i]` and `offsets[2 * i + 1]`, its value
+// is between `offsets[2 * i + 1]` and `offsets[2 * i + 2]`.
+IncomingMessage.prototype.setRawHeaders = function(raw, offsets) {
+  if (this._rawHeaders) {
+    this._decodeRawHeaders();
+  }
+
+  this._rawHeaders = raw;
+  this._rawHeaderOffsets = offsets;
+};
+
+
+IncomingMessage.prototype._decodeRawHeaders = function() {
+  var raw = this._rawHeaders;
+  var offsets = this._rawHeaderOffsets;
+  var headers = this._headerObject;
+
+  this._rawHeaders = null;
+  this._rawHeaderOffsets = null;
+
+  for (var i = 0; i + 2 < offsets.length; i += 2) {
+    var name = raw.toString(undefined, offsets[i], offsets[i + 1]);
+    headers[name] = raw.toString(undefined, offsets[i + 1], offsets[i + 2]);
+  }
+};
+
+
 IncomingMessage.prototype.setTimeout = function(ms, cb) {
   if (cb)
     this.once('timeout', cb);
@@ -160,6 +160,8 @@ function initServer(options, requestListener) {
 
   this._IncomingMessage = options.IncomingMessage || IncomingMessage;
   this._ServerResponse = options.ServerResponse || ServerResponse;
+  this._lazyHeaders = !!options.lazyHeaders;
+  this._nativeParsing = !!options.nativeParsing;
   this.httpAllowHalfOpen = false;
 
   this.on('clientError', function(err, conn) {
@@ -176,7 +178,8 @@ function connectionListener(socket) {
 
   // cf) In Node.js, freelist returns a new parser.
   // parser initialize
-  var parser = common.createHTTPParser(HTTPParser.REQUEST);
+  var parser = common.createHTTPParser(HTTPParser.REQUEST,
+                                       server._lazyHeaders);
   parser._headers = [];
   parser._url = '';
 
@@ -187,7 +190,10 @@ function connectionListener(socket) {
   parser.incoming = null;
   socket.parser = parser;
 
-  socket.on('data', socketOnData);
+  if (!server._nativeParsing ||
+      !common.consumeSocket(parser, socket, parserOnExecuteError)) {
+    socket.on('data', socketOnData);
+  }
   socket.on('end', socketOnEnd);
   socket.on('close', socketOnClose);
   socket.on('timeout', socketOnTimeout);
@@ -212,17 +218,24 @@ function socketOnData(data) {
 }
 
 
+// Parse error of a consumed socket.
+function parserOnExecuteError() {
+  this.socket.destroy();
+}
+
+
 function socketOnEnd() {
   var socket = this;
   var server = socket._server;
-  var ret = socket.parser.finish();
+  var parser = socket.parser;
+  var ret = parser.finish();
 
   if (ret instanceof Error) {
     socket.destroy();
     return;
   }
 
-  socket.parser = null;
+  common.freeParser(parser, socket);
 
   if (!server.httpAllowHalfOpen && socket._socketState.writable) {
     socket.end();
@@ -234,7 +247,7 @@ function socketOnClose() {
   var socket = this;
 
   if (socket.parser) {
-    socket.parser = null;
+    common.freeParser(socket.parser, socket);
   }
 }
 
@@ -68,6 +68,7 @@
   global.setInterval = _timeoutHandler.bind(this, 'setInterval');
   global.clearTimeout = _timeoutHandler.bind(this, 'clearTimeout');
   global.clearInterval = _timeoutHandler.bind(this, 'clearInterval');
+  global.clearImmediate = _timeoutHandler.bind(this, 'clearImmediate');
 
   var EventEmitter = Module.require('events').EventEmitter;
 
@@ -83,43 +84,6 @@
     }
   }
 
-  var nextTickQueue = [];
-
-  process.nextTick = nextTick;
-  process._onNextTick = _onNextTick;
-
-
-  function _onNextTick() {
-    // clone nextTickQueue to new array object, and calls function
-    // iterating the cloned array. This is because,
-    // during processing nextTick
-    // a callback could add another next tick callback using
-    // `process.nextTick()`, if we calls back iterating original
-    // `nextTickQueue` that could turn into infinite loop.
-
-    var callbacks = nextTickQueue.slice(0);
-    nextTickQueue = [];
-
-    var len = callbacks.length;
-    for (var i = 0; i < len; ++i) {
-      try {
-        callbacks[i]();
-      } catch (e) {
-        process._onUncaughtException(e);
-      }
-    }
-
-    return nextTickQueue.length > 0;
-  }
-
-
-  function nextTick(callback) {
-    var args = Array.prototype.slice.call(arguments);
-    args[0] = null;
-    nextTickQueue.push(Function.prototype.bind.apply(callback, args));
-  }
-
-
   process._onUncaughtException = _onUncaughtException;
   function _onUncaughtException(error) {
     var event = 'uncaughtException';
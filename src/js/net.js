@@ -40,6 +40,9 @@ function SocketState(options) {
   // become 'true' when connection established.
   this.connected = false;
 
+  // 'true' while the handle delivers incoming data.
+  this.reading = false;
+
   this.writable = true;
   this.readable = true;
 
@@ -61,6 +64,9 @@ function Socket(options) {
 
   stream.Duplex.call(this, options);
 
+  // String chunks are encoded by the native write.
+  this._writableState.decodeStrings = false;
+
   this._timer = null;
   this._timeout = 0;
 
@@ -150,7 +156,7 @@ Socket.prototype.write = function(data, callback) {
 
 
 Socket.prototype._write = function(chunk, callback, afterWrite) {
-  assert(util.isBuffer(chunk));
+  assert(util.isBuffer(chunk) || util.isString(chunk));
   assert(util.isFunction(afterWrite));
 
   var self = this;
@@ -177,6 +183,48 @@ Socket.prototype._write = function(chunk, callback, afterWrite) {
 };
 
 
+// Write all of the buffered chunks with a single request.
+Socket.prototype._writev = function(reqs, afterWrite) {
+  assert(util.isFunction(afterWrite));
+
+  var self = this;
+  var chunks = new Array(reqs.length);
+  for (var i = 0; i < reqs.length; ++i) {
+    chunks[i] = reqs[i].chunk;
+  }
+
+  var onwrite = function(status) {
+    afterWrite(status);
+    for (var i = 0; i < reqs.length; ++i) {
+      if (util.isFunction(reqs[i].callback)) {
+        reqs[i].callback.call(self, status);
+      }
+    }
+  };
+
+  if (self.errored) {
+    process.nextTick(onwrite, 1);
+  } else {
+    resetSocketTimeout(self);
+
+    self._handle.owner = self;
+
+    self._handle.writev(chunks, onwrite);
+  }
+};
+
+
+// The readable buffer has room again, restart reading from the handle.
+Socket.prototype._read = function() {
+  var state = this._socketState;
+
+  if (state.connected && !state.reading && this._handle) {
+    state.reading = true;
+    this._handle.readStart();
+  }
+};
+
+
 Socket.prototype.end = function(data, callback) {
   var self = this;
   var state = self._socketState;
@@ -267,10 +315,7 @@ Socket.prototype.setTimeout = function(msecs, callback) {
       self.removeListener('timeout', callback);
     }
   } else {
-    self._timer = setTimeout(function() {
-      self.emit('timeout');
-      clearSocketTimeout(self);
-    }, msecs);
+    resetSocketTimeout(self);
     if (callback) {
       self.once('timeout', callback);
     }
@@ -324,16 +369,27 @@ function close(socket) {
 }
 
 
+// Starts the idle timer unless it is already running. I/O does not restart
+// the timer: the handle records the time of its last activity, which is only
+// checked when the timer expires.
 function resetSocketTimeout(socket) {
   var state = socket._socketState;
 
-  if (!state.destroyed) {
-    // start timeout over again
+  if (!state.destroyed && !socket._timer && socket._timeout > 0) {
+    socket._timer = setTimeout(onSocketTimeout, socket._timeout, socket);
+  }
+}
+
+
+function onSocketTimeout(socket) {
+  var idle = socket._handle ? socket._handle.idleTime() : socket._timeout;
+
+  if (idle < socket._timeout) {
+    // There was some activity since the timer started, wait for the rest.
+    socket._timer._restart(idle);
+  } else {
     clearSocketTimeout(socket);
-    socket._timer = setTimeout(function() {
-      socket.emit('timeout');
-      clearSocketTimeout(socket);
-    }, socket._timeout);
+    socket.emit('timeout');
   }
 }
 
@@ -381,11 +437,27 @@ function onSocketConnect(socket) {
   process.nextTick(function() {
     socket._handle.owner = socket;
     socket._handle.onread = onread;
-    socket._handle.readStart();
+    if (!state.reading) {
+      state.reading = true;
+      socket._handle.readStart();
+    }
   });
 }
 
 
+// Push received data to the readable side. Reading from the handle stops
+// while the buffered data is above the high water mark.
+function pushData(socket, buffer) {
+  var state = socket._socketState;
+
+  if (!stream.Readable.prototype.push.call(socket, buffer) &&
+      state.reading && socket._handle) {
+    state.reading = false;
+    socket._handle.readStop();
+  }
+}
+
+
 function onread(socket, nread, isEOF, buffer) {
   var state = socket._socketState;
 
@@ -406,7 +478,7 @@ function onread(socket, nread, isEOF, buffer) {
     stream.Readable.prototype.error.call(socket, err);
   } else if (nread > 0) {
     if (process.platform !== 'nuttx') {
-      stream.Readable.prototype.push.call(socket, buffer);
+      pushData(socket, buffer);
       return;
     }
 
@@ -426,7 +498,7 @@ function onread(socket, nread, isEOF, buffer) {
     if (bufferLength == eofLength && eofNeeded) {
       // Socket.prototype.end with no argument
     } else {
-      stream.Readable.prototype.push.call(socket, buffer);
+      pushData(socket, buffer);
     }
 
     if (eofNeeded) {
@@ -19,6 +19,9 @@ var Writable = require('stream_writable');
 var util = require('util');
 
 
+var defaultHighWaterMark = 16 * 1024;
+
+
 function ReadableState(options) {
   options = options || {};
 
@@ -30,6 +33,11 @@ function ReadableState(options) {
 
   this.defaultEncoding = options.defaultEncoding || 'utf8';
 
+  // high water mark.
+  // The point where push() starts returning false.
+  this.highWaterMark = util.isNumber(options.highWaterMark) ?
+    options.highWaterMark : defaultHighWaterMark;
+
   // true if in flowing mode.
   this.flowing = false;
 
@@ -70,10 +78,21 @@ Readable.prototype.read = function(n) {
     res = null;
   }
 
+  // There is room in the buffer again, ask the underlying resource for more.
+  if (!state.ended && state.length < state.highWaterMark) {
+    this._read(state.highWaterMark - state.length);
+  }
+
   return res;
 };
 
 
+// Called when the stream is ready to take more data. Concrete streams that
+// stopped producing data because push() returned false should restart here.
+Readable.prototype._read = function(/* size */) {
+};
+
+
 Readable.prototype.on = function(ev, cb) {
   var res = Stream.prototype.on.call(this, ev, cb);
   if (ev === 'data') {
@@ -136,6 +155,9 @@ Readable.prototype.push = function(chunk, encoding) {
       this.emit('readable');
     }
   }
+
+  // `false` tells the producer to stop until `_read()` is called.
+  return !state.ended && state.length < state.highWaterMark;
 };
 
 
@@ -147,14 +169,19 @@ Readable.prototype.pipe = function(destination, options) {
 
   options = options || {'end': true};
 
+  // `awaitDrain` is set while the source is paused because the destination
+  // can not take more data.
   var listeners = {
-    readableListener: readableListener.bind(this),
-    dataListener: dataListener.bind(destination),
-    endListener: endListener.bind(destination),
+    awaitDrain: false,
   };
+  listeners.readableListener = readableListener.bind(this, listeners);
+  listeners.dataListener = dataListener.bind(this, destination, listeners);
+  listeners.drainListener = drainListener.bind(this, listeners);
+  listeners.endListener = endListener.bind(destination);
 
   this.on('readable', listeners.readableListener);
   this.on('data', listeners.dataListener);
+  destination.on('drain', listeners.drainListener);
 
   if (options.end) {
     this.on('end', listeners.endListener);
@@ -172,6 +199,11 @@ Readable.prototype.pipe = function(destination, options) {
 
 Readable.prototype.unpipe = function(destination) {
   if (destination === undefined) {
+    var piped = this._piped || [];
+    for (var i = 0; i < piped.length; ++i) {
+      piped[i].removeListener('drain',
+                              this._piped_listeners[i].drainListener);
+    }
     this.removeAllListeners();
     this._piped = undefined;
     this._piped_listeners = undefined;
@@ -189,18 +221,33 @@ Readable.prototype.unpipe = function(destination) {
   this.removeListener('readable', listeners.readableListener);
   this.removeListener('data', listeners.dataListener);
   this.removeListener('end', listeners.endListener);
+  destination.removeListener('drain', listeners.drainListener);
 
   return destination;
 };
 
 
-function readableListener() {
-  this.resume();
+function readableListener(listeners) {
+  if (!listeners.awaitDrain) {
+    this.resume();
+  }
 }
 
 
-function dataListener(data) {
-  this.write(data);
+function dataListener(destination, listeners, data) {
+  // Stop the flow until the destination has flushed its buffer.
+  if (destination.write(data) === false) {
+    listeners.awaitDrain = true;
+    this.pause();
+  }
+}
+
+
+function drainListener(listeners) {
+  if (listeners.awaitDrain) {
+    listeners.awaitDrain = false;
+    this.resume();
+  }
 }
 
 
@@ -220,7 +267,7 @@ function readBuffer(stream, n) {
   if (state.buffer.length === 0 || state.length === 0) {
     res = null;
   } else if (n >= state.length) {
-    res = Buffer.concat(state.buffer);
+    res = Buffer.concat(state.buffer, state.length);
     state.buffer = [];
     state.length = 0;
     emitData(stream, res);
@@ -20,8 +20,10 @@ var util = require('util');
 var defaultHighWaterMark = 128;
 
 
-function WriteReq(chunk, callback) {
+function WriteReq(chunk, length, callback) {
   this.chunk = chunk;
+  // Number of bytes of the chunk, counted in `WritableState.length`.
+  this.length = length;
   this.callback = callback;
 }
 
@@ -38,6 +40,10 @@ function WritableState(options) {
   this.highWaterMark = (options && util.isNumber(options.highWaterMark)) ?
     options.highWaterMark : defaultHighWaterMark;
 
+  // `false` if string chunks are passed to `_write()` as they are, instead of
+  // being converted into Buffers first.
+  this.decodeStrings = !(options && options.decodeStrings === false);
+
   // 'true' if stream is ready to write.
   this.ready = false;
 
@@ -47,6 +53,10 @@ function WritableState(options) {
   // the length of message being writing.
   this.writingLength = 0;
 
+  // number of pending `cork()` calls. While non zero, written data is only
+  // buffered.
+  this.corked = 0;
+
   // turn 'true' when some messages are buffered. After buffered messages are
   // all sent, 'drain' event will be emitted.
   this.needDrain = false;
@@ -105,6 +115,31 @@ Writable.prototype._write = function(/* chunk, callback, onwrite */) {
 };
 
 
+// Concrete streams able to write several chunks at once may define
+// `_writev(reqs, onwrite)`, where `reqs` is an array of `{chunk, callback}`
+// objects. All buffered chunks are then flushed with a single call.
+
+
+// Buffer all written data until `uncork()` is called.
+Writable.prototype.cork = function() {
+  this._writableState.corked++;
+};
+
+
+// Flush the data buffered since the matching `cork()` call.
+Writable.prototype.uncork = function() {
+  var state = this._writableState;
+
+  if (state.corked) {
+    state.corked--;
+
+    if (!state.corked && state.ready) {
+      writeBuffered(this);
+    }
+  }
+};
+
+
 Writable.prototype.end = function(chunk, callback) {
   var state = this._writableState;
 
@@ -126,6 +161,12 @@ Writable.prototype.end = function(chunk, callback) {
     this.write(chunk);
   }
 
+  // Ending flushes the corked data.
+  if (state.corked) {
+    state.corked = 1;
+    this.uncork();
+  }
+
   if (!state.ending) {
     endWritable(this, callback);
   }
@@ -168,19 +209,22 @@ function writeAfterEnd(stream, callback) {
 function writeOrBuffer(stream, chunk, callback) {
   var state = stream._writableState;
 
-  if (util.isString(chunk)) {
+  if (state.decodeStrings && util.isString(chunk)) {
     chunk = new Buffer(chunk);
   }
 
-  state.length += chunk.length;
+  // Strings are counted in bytes, like the Buffers they are written as.
+  var length = util.isString(chunk) ? Buffer.byteLength(chunk) : chunk.length;
+  state.length += length;
 
-  if (!state.ready || state.writing || state.buffer.length > 0) {
+  if (!state.ready || state.writing || state.corked ||
+      state.buffer.length > 0) {
     // stream not yet ready or there is pending request to write.
     // push this request into write queue.
-    state.buffer.push(new WriteReq(chunk, callback));
+    state.buffer.push(new WriteReq(chunk, length, callback));
   } else {
     // here means there is no pending data. write out.
-    doWrite(stream, chunk, callback);
+    doWrite(stream, chunk, length, callback);
   }
 
   // total length of buffered message exceeded high water mark.
@@ -194,18 +238,22 @@ function writeOrBuffer(stream, chunk, callback) {
 
 function writeBuffered(stream) {
   var state = stream._writableState;
-  if (!state.writing) {
+  if (!state.writing && !state.corked) {
     if (state.buffer.length == 0) {
       onEmptyBuffer(stream);
+    } else if (state.buffer.length > 1 && util.isFunction(stream._writev)) {
+      var reqs = state.buffer;
+      state.buffer = [];
+      doWritev(stream, reqs);
     } else {
       var req = state.buffer.shift();
-      doWrite(stream, req.chunk, req.callback);
+      doWrite(stream, req.chunk, req.length, req.callback);
     }
   }
 }
 
 
-function doWrite(stream, chunk, callback) {
+function doWrite(stream, chunk, length, callback) {
   var state = stream._writableState;
 
   if (state.writing) {
@@ -214,13 +262,28 @@ function doWrite(stream, chunk, callback) {
 
   // The stream is now writing.
   state.writing = true;
-  state.writingLength = chunk.length;
+  state.writingLength = length;
 
   // Write down the chunk data.
   stream._write(chunk, callback, stream._onwrite.bind(stream));
 }
 
 
+function doWritev(stream, reqs) {
+  var state = stream._writableState;
+
+  // The stream is now writing.
+  state.writing = true;
+  state.writingLength = 0;
+  for (var i = 0; i < reqs.length; ++i) {
+    state.writingLength += reqs[i].length;
+  }
+
+  // Write down all of the chunks at once.
+  stream._writev(reqs, stream._onwrite.bind(stream));
+}
+
+
 // No more data to write. if this stream is being finishing, emit 'finish'.
 function onEmptyBuffer(stream) {
   var state = stream._writableState;
@@ -20,7 +20,6 @@ var TIMEOUT_MAX = '2147483647.0' - 0; // 2^31-1
 var TIMER_TYPES = {
   setTimeout: 0,
   setInterval: 1,
-  setImmediate: 2,
 };
 
 
@@ -28,49 +27,273 @@ function Timeout(after) {
   this.after = after;
   this.isRepeat = false;
   this.callback = null;
-  this.handler = null;
+
+  // The timer list this timeout is enrolled in and its links.
+  this._list = null;
+  this._idlePrev = null;
+  this._idleNext = null;
+
+  // Loop time when the timeout was (re)started and its enrollment order.
+  this._idleStart = 0;
+  this._idleSeq = 0;
 }
 
 
-native.prototype.handleTimeout = function() {
-  var timeout = this.timeoutObj; // 'this' is native object
-  if (timeout && timeout.callback) {
-    try {
-      timeout.callback();
-    } catch (e) {
-      timeout.unref();
-      throw e;
+// All timeouts share a single native timer. Timeouts with the same duration
+// expire in the order they were started, so every duration has its own
+// circular list where new timeouts are appended to the tail and the head
+// always expires first. The lists are kept in a binary min-heap ordered by
+// the expiry of their heads, and the native timer is armed for the root.
+// A timeout restarted for the rest of its duration goes to the list of the
+// remaining time. Starting, clearing and restarting a timeout are O(1),
+// except for a heap update when a list gets a new head, which is
+// O(log number of lists).
+var timerLists = {};
+var listHeap = [];
+var timerHandle = null;
+var timerSeq = 0;
+
+// Loop time the native timer is armed for, -1 if it is stopped.
+var armedExpiry = -1;
+
+
+function TimerList(after) {
+  this.after = after;
+  this._idlePrev = this;
+  this._idleNext = this;
+  this._heapIndex = -1;
+}
+
+
+// Whether the head of list `a` expires before the head of list `b`, the one
+// started first on ties.
+function listBefore(a, b) {
+  var headA = a._idleNext;
+  var headB = b._idleNext;
+  var expiryA = headA._idleStart + a.after;
+  var expiryB = headB._idleStart + b.after;
+  return expiryA < expiryB ||
+         (expiryA == expiryB && headA._idleSeq < headB._idleSeq);
+}
+
+
+function heapSet(index, list) {
+  listHeap[index] = list;
+  list._heapIndex = index;
+}
+
+
+function heapUp(index) {
+  var list = listHeap[index];
+  while (index > 0) {
+    var parent = (index - 1) >> 1;
+    if (!listBefore(list, listHeap[parent])) {
+      break;
     }
+    heapSet(index, listHeap[parent]);
+    index = parent;
+  }
+  heapSet(index, list);
+}
 
-    if (!timeout.isRepeat) {
-      timeout.unref();
+
+function heapDown(index) {
+  var list = listHeap[index];
+  var length = listHeap.length;
+  for (;;) {
+    var child = index * 2 + 1;
+    if (child >= length) {
+      break;
+    }
+    if (child + 1 < length && listBefore(listHeap[child + 1],
+                                         listHeap[child])) {
+      child++;
+    }
+    if (!listBefore(listHeap[child], list)) {
+      break;
     }
+    heapSet(index, listHeap[child]);
+    index = child;
   }
-};
+  heapSet(index, list);
+}
 
 
-Timeout.prototype.ref = function() {
-  var repeat = 0;
-  var handler = new native();
+function heapRemove(list) {
+  var index = list._heapIndex;
+  var last = listHeap.pop();
+  list._heapIndex = -1;
+
+  if (last !== list) {
+    heapSet(index, last);
+    heapDown(index);
+    heapUp(last._heapIndex);
+  }
+}
+
+
+function getTimerHandle() {
+  if (!timerHandle) {
+    timerHandle = new native();
+  }
+  return timerHandle;
+}
+
+
+// Starts the timeout as if it was started `elapsed` milliseconds ago, by
+// appending it to the list of the remaining time.
+function enroll(timeout, elapsed) {
+  var handle = getTimerHandle();
+  var duration = Math.max(timeout.after - (elapsed || 0), 0);
+  var list = timerLists[duration];
+  if (!list) {
+    list = timerLists[duration] = new TimerList(duration);
+  }
+
+  timeout._idleStart = handle.now();
+  timeout._idleSeq = timerSeq++;
+  timeout._list = list;
+
+  var prev = list._idlePrev;
+  timeout._idlePrev = prev;
+  timeout._idleNext = list;
+  prev._idleNext = timeout;
+  list._idlePrev = timeout;
+
+  if (list._heapIndex < 0) {
+    listHeap.push(list);
+    heapUp(listHeap.length - 1);
+  }
+
+  var expiry = timeout._idleStart + duration;
+  if (armedExpiry < 0 || expiry < armedExpiry) {
+    armedExpiry = expiry;
+    handle.start(duration, 0);
+  }
+}
+
+
+// The native timer is stopped once no timeout is left, so a cleared timeout
+// does not keep the loop alive. Otherwise it is not re-armed here: if the
+// cleared timeout was the earliest, the timer fires early, finds nothing
+// due and re-arms itself for the next head.
+function unenroll(timeout) {
+  if (!timeout._idleNext) {
+    return;
+  }
+
+  var list = timeout._list;
+  var wasHead = list._idleNext === timeout;
+  timeout._list = null;
+
+  timeout._idlePrev._idleNext = timeout._idleNext;
+  timeout._idleNext._idlePrev = timeout._idlePrev;
+  timeout._idlePrev = null;
+  timeout._idleNext = null;
 
-  if (this.isRepeat) {
-    repeat = this.after;
+  if (list._idleNext === list) {
+    delete timerLists[list.after];
+    heapRemove(list);
 
+    if (armedExpiry >= 0 && listHeap.length == 0) {
+      armedExpiry = -1;
+      timerHandle.stop();
+    }
+  } else if (wasHead) {
+    // The new head expires later.
+    heapDown(list._heapIndex);
   }
+}
+
 
-  handler.timeoutObj = this;
-  this.handler = handler;
+// Returns the list whose first timeout expires the earliest.
+function earliestList() {
+  return listHeap.length > 0 ? listHeap[0] : null;
+}
+
+
+function arm(handle, now) {
+  var list = earliestList();
+  if (list) {
+    armedExpiry = list._idleNext._idleStart + list.after;
+    handle.start(Math.max(armedExpiry - now, 0), 0);
+  } else {
+    armedExpiry = -1;
+    handle.stop();
+  }
+}
 
-  handler.start(this.after, repeat);
+
+native.prototype.handleTimeout = function() {
+  var handle = this; // 'this' is native object
+  var now = handle.now();
+
+  // Timeouts started by the callbacks run on the next expiry at earliest.
+  var lastSeq = timerSeq;
+
+  armedExpiry = -1;
+
+  try {
+    for (;;) {
+      var list = earliestList();
+      if (!list) {
+        break;
+      }
+
+      var timeout = list._idleNext;
+      if (timeout._idleStart + list.after > now ||
+          timeout._idleSeq >= lastSeq) {
+        break;
+      }
+
+      unenroll(timeout);
+      if (!timeout.callback) {
+        continue;
+      }
+      if (timeout.isRepeat) {
+        enroll(timeout);
+      }
+
+      try {
+        timeout.callback();
+      } catch (e) {
+        timeout.unref();
+        throw e;
+      }
+    }
+  } finally {
+    arm(handle, now);
+  }
+};
+
+
+Timeout.prototype.ref = function() {
+  unenroll(this);
+  enroll(this);
 };
 
 
 Timeout.prototype.unref = function() {
   this.callback = undefined;
-  if (this.handler) {
-    this.handler.timeoutObj = undefined;
-    this.handler.stop();
-    this.handler = undefined;
+  unenroll(this);
+};
+
+
+// Restarts the timeout with its current duration.
+Timeout.prototype.refresh = function() {
+  if (this.callback) {
+    this.ref();
+  }
+  return this;
+};
+
+
+// Restarts the timeout as if it was started `elapsed` milliseconds ago.
+// Used by idle timeouts that check the last activity only on expiry.
+Timeout.prototype._restart = function(elapsed) {
+  if (this.callback) {
+    unenroll(this);
+    enroll(this, elapsed);
   }
 };
 
@@ -80,13 +303,11 @@ function timeoutConfigurator(type, callback, delay) {
     throw new TypeError('Bad arguments: callback must be a Function');
   }
 
-  if (type === TIMER_TYPES.setImmediate) {
-    delay = 0;
+  delay *= 1;
+  if (!(delay >= 1 && delay <= TIMEOUT_MAX)) {
+    delay = 1;
   } else {
-    delay *= 1;
-    if (delay < 1 || delay > TIMEOUT_MAX) {
-      delay = 1;
-    }
+    delay = Math.floor(delay);
   }
 
   var timeout = new Timeout(delay);
@@ -109,13 +330,30 @@ exports.setTimeout = timeoutConfigurator.bind(undefined,
                                               TIMER_TYPES.setTimeout);
 exports.setInterval = timeoutConfigurator.bind(undefined,
                                                TIMER_TYPES.setInterval);
-exports.setImmediate = timeoutConfigurator.bind(undefined,
-                                                TIMER_TYPES.setImmediate);
+
+
+// Immediates live in a native queue that is run once per loop iteration,
+// the object only keeps the id needed to cancel it.
+function Immediate(id) {
+  this._id = id;
+}
+
+
+exports.setImmediate = function(callback) {
+  if (!util.isFunction(callback)) {
+    throw new TypeError('Bad arguments: callback must be a Function');
+  }
+
+  return new Immediate(native.setImmediate.apply(undefined, arguments));
+};
+
 
 function clearTimeoutBase(timeoutType, timeout) {
   if (timeout) {
     if (timeout instanceof Timeout) {
       timeout.unref();
+    } else if (timeout instanceof Immediate) {
+      native.clearImmediate(timeout._id);
     } else {
        throw new Error(timeoutType + '() - invalid timeout');
     }
@@ -124,3 +362,4 @@ function clearTimeoutBase(timeoutType, timeout) {
 
 exports.clearTimeout = clearTimeoutBase.bind(undefined, 'clearTimeout');
 exports.clearInterval = clearTimeoutBase.bind(undefined, 'clearInterval');
+exports.clearImmediate = clearTimeoutBase.bind(undefined, 'clearImmediate');
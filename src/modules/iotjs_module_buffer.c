@@ -20,40 +20,261 @@
 #include <stdlib.h>
 #include <string.h>
 
+// Hex and base64 conversions use 128 bit vector kernels when the target
+// supports them. IoT.js is built for a specific target, so the kernels
+// are selected at compile time. IOTJS_BUFFER_NO_SIMD forces scalar code.
+#if !defined(IOTJS_BUFFER_NO_SIMD) && defined(__SSE2__)
+#define BUFFER_CODEC_SSE2
+#include <emmintrin.h>
+#elif !defined(IOTJS_BUFFER_NO_SIMD) && defined(__ARM_NEON)
+#define BUFFER_CODEC_NEON
+#include <arm_neon.h>
+#endif
+
 typedef enum {
   BUFFER_HEX_ENC = 0,
   BUFFER_BASE64_ENC = 1,
 } buffer_encoding_type_t;
 
+typedef enum {
+  BUFFER_NUMBER_UINT,
+  BUFFER_NUMBER_INT,
+  BUFFER_NUMBER_FLOAT,
+} buffer_number_type_t;
+
+
+// Storage of small buffers is allocated in power of two size classes
+// from IOTJS_BUFFER_POOL_MIN_SIZE up to IOTJS_BUFFER_POOL_MAX_SIZE bytes.
+// Released blocks are kept in per class free lists for reuse, as long as
+// the pooled memory stays below IOTJS_BUFFER_POOL_MAX_BYTES.
+#ifndef IOTJS_BUFFER_POOL_MAX_BYTES
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_BUFFER_POOL_MAX_BYTES (16 * 1024)
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_BUFFER_POOL_MAX_BYTES (256 * 1024)
+#endif /* __NUTTX__ || __TIZENRT__ */
+#endif /* IOTJS_BUFFER_POOL_MAX_BYTES */
+
+#define IOTJS_BUFFER_POOL_MIN_SIZE 64
+#define IOTJS_BUFFER_POOL_CLASS_COUNT 8
+#define IOTJS_BUFFER_POOL_MAX_SIZE \
+  (IOTJS_BUFFER_POOL_MIN_SIZE << (IOTJS_BUFFER_POOL_CLASS_COUNT - 1))
+
+typedef struct buffer_pool_block_s {
+  struct buffer_pool_block_s* next;
+} buffer_pool_block_t;
+
+typedef struct {
+  buffer_pool_block_t* free_list;
+  uint32_t live;
+  uint32_t pooled;
+  uint32_t hits;
+  uint32_t misses;
+} buffer_pool_class_t;
+
+static struct {
+  buffer_pool_class_t classes[IOTJS_BUFFER_POOL_CLASS_COUNT];
+  size_t pooled_bytes;
+  uint32_t large_live;
+} buffer_pool;
+
+
+// Stream reads are received into a shared slab: each read gets the unused
+// tail of the slab and the received bytes are passed to JS as a slice of
+// it. A new slab is started when the tail cannot hold a whole read, the
+// old one is freed once all of its slices are gone.
+#ifndef IOTJS_BUFFER_SLAB_SIZE
+#define IOTJS_BUFFER_SLAB_SIZE (2 * (IOTJS_MAX_READ_BUFFER_SIZE + 1))
+#endif /* IOTJS_BUFFER_SLAB_SIZE */
+
+static struct {
+  iotjs_bufferwrap_t* bufferwrap;
+  size_t used;
+} buffer_slab;
+
 
 IOTJS_DEFINE_NATIVE_HANDLE_INFO_THIS_MODULE(bufferwrap);
 
+static void iotjs_bufferwrap_unref(iotjs_bufferwrap_t* bufferwrap);
 
-iotjs_bufferwrap_t* iotjs_bufferwrap_create(const jerry_value_t jobject,
-                                            size_t length) {
-  iotjs_bufferwrap_t* bufferwrap = (iotjs_bufferwrap_t*)iotjs_buffer_allocate(
-      sizeof(iotjs_bufferwrap_t) + length);
 
+static int buffer_pool_class_index(size_t length) {
+  if (length > IOTJS_BUFFER_POOL_MAX_SIZE) {
+    return -1;
+  }
+
+  int index = 0;
+  size_t capacity = IOTJS_BUFFER_POOL_MIN_SIZE;
+  while (capacity < length) {
+    capacity <<= 1;
+    index++;
+  }
+  return index;
+}
+
+
+static iotjs_bufferwrap_t* buffer_pool_alloc(size_t length, bool zero_fill) {
+  int index = buffer_pool_class_index(length);
+  iotjs_bufferwrap_t* bufferwrap;
+
+  if (index < 0) {
+    size_t size = sizeof(iotjs_bufferwrap_t) + length;
+    buffer_pool.large_live++;
+    char* memory = zero_fill ? iotjs_buffer_allocate(size)
+                             : iotjs_buffer_allocate_uninitialized(size);
+    bufferwrap = (iotjs_bufferwrap_t*)memory;
+  } else {
+    buffer_pool_class_t* pool_class = &buffer_pool.classes[index];
+    size_t capacity = (size_t)IOTJS_BUFFER_POOL_MIN_SIZE << index;
+    pool_class->live++;
+
+    if (pool_class->free_list != NULL) {
+      buffer_pool_block_t* block = pool_class->free_list;
+      pool_class->free_list = block->next;
+      pool_class->pooled--;
+      pool_class->hits++;
+      buffer_pool.pooled_bytes -= capacity;
+      bufferwrap = (iotjs_bufferwrap_t*)block;
+    } else {
+      pool_class->misses++;
+      bufferwrap = (iotjs_bufferwrap_t*)iotjs_buffer_allocate_uninitialized(
+          sizeof(iotjs_bufferwrap_t) + capacity);
+    }
+
+    if (zero_fill) {
+      memset(bufferwrap->storage, 0, length);
+    }
+  }
+
+  memset(bufferwrap, 0, sizeof(iotjs_bufferwrap_t));
+  return bufferwrap;
+}
+
+
+static void buffer_pool_free(iotjs_bufferwrap_t* bufferwrap) {
+  int index = buffer_pool_class_index(bufferwrap->length);
+
+  if (index < 0) {
+    buffer_pool.large_live--;
+    IOTJS_RELEASE(bufferwrap);
+    return;
+  }
+
+  buffer_pool_class_t* pool_class = &buffer_pool.classes[index];
+  size_t capacity = (size_t)IOTJS_BUFFER_POOL_MIN_SIZE << index;
+  pool_class->live--;
+
+  if (buffer_pool.pooled_bytes + capacity > IOTJS_BUFFER_POOL_MAX_BYTES) {
+    IOTJS_RELEASE(bufferwrap);
+    return;
+  }
+
+  buffer_pool_block_t* block = (buffer_pool_block_t*)bufferwrap;
+  block->next = pool_class->free_list;
+  pool_class->free_list = block;
+  pool_class->pooled++;
+  buffer_pool.pooled_bytes += capacity;
+}
+
+
+void iotjs_bufferwrap_pool_cleanup(void) {
+  if (buffer_slab.bufferwrap != NULL) {
+    iotjs_bufferwrap_unref(buffer_slab.bufferwrap);
+    buffer_slab.bufferwrap = NULL;
+  }
+
+  for (int i = 0; i < IOTJS_BUFFER_POOL_CLASS_COUNT; i++) {
+    buffer_pool_class_t* pool_class = &buffer_pool.classes[i];
+
+    while (pool_class->free_list != NULL) {
+      buffer_pool_block_t* block = pool_class->free_list;
+      pool_class->free_list = block->next;
+      IOTJS_RELEASE(block);
+    }
+    pool_class->pooled = 0;
+  }
+  buffer_pool.pooled_bytes = 0;
+}
+
+
+static void iotjs_bufferwrap_bind(iotjs_bufferwrap_t* bufferwrap,
+                                  const jerry_value_t jobject, size_t length) {
   bufferwrap->jobject = jobject;
   jerry_set_object_native_pointer(jobject, bufferwrap,
                                   &this_module_native_info);
 
   bufferwrap->length = length;
+  bufferwrap->refcount = 1;
 
   IOTJS_ASSERT(
       jerry_get_object_native_pointer(jobject, NULL, &this_module_native_info));
+}
+
+
+static iotjs_bufferwrap_t* iotjs_bufferwrap_create_internal(
+    const jerry_value_t jobject, size_t length, bool zero_fill) {
+  iotjs_bufferwrap_t* bufferwrap = buffer_pool_alloc(length, zero_fill);
+
+  bufferwrap->buffer = bufferwrap->storage;
+  iotjs_bufferwrap_bind(bufferwrap, jobject, length);
   return bufferwrap;
 }
 
 
-static void iotjs_bufferwrap_destroy(iotjs_bufferwrap_t* bufferwrap) {
+iotjs_bufferwrap_t* iotjs_bufferwrap_create(const jerry_value_t jobject,
+                                            size_t length) {
+  return iotjs_bufferwrap_create_internal(jobject, length, true);
+}
+
+
+iotjs_bufferwrap_t* iotjs_bufferwrap_create_slice(
+    const jerry_value_t jobject, iotjs_bufferwrap_t* source, size_t offset,
+    size_t length) {
+  IOTJS_ASSERT(offset + length <= source->length);
+
+  // Slices of slices share the storage of the original buffer.
+  iotjs_bufferwrap_t* parent = source->parent ? source->parent : source;
+  parent->refcount++;
+
+  iotjs_bufferwrap_t* bufferwrap = IOTJS_ALLOC(iotjs_bufferwrap_t);
+  bufferwrap->buffer = source->buffer + offset;
+  bufferwrap->parent = parent;
+  iotjs_bufferwrap_bind(bufferwrap, jobject, length);
+  return bufferwrap;
+}
+
+
+static void iotjs_bufferwrap_unref(iotjs_bufferwrap_t* bufferwrap) {
+  IOTJS_ASSERT(bufferwrap->refcount > 0);
+
+  if (--bufferwrap->refcount > 0) {
+    // The storage is still referenced by slices.
+    return;
+  }
+
+  if (bufferwrap->parent) {
+    iotjs_bufferwrap_unref(bufferwrap->parent);
+  }
+
   if (bufferwrap->external_info && bufferwrap->external_info->free_hint) {
     ((void (*)(void*))bufferwrap->external_info->free_hint)(
         bufferwrap->external_info->free_info);
   }
 
   IOTJS_RELEASE(bufferwrap->external_info);
-  IOTJS_RELEASE(bufferwrap);
+
+  if (bufferwrap->parent) {
+    IOTJS_RELEASE(bufferwrap);
+  } else {
+    buffer_pool_free(bufferwrap);
+  }
+}
+
+
+static void iotjs_bufferwrap_destroy(iotjs_bufferwrap_t* bufferwrap) {
+  // The object is gone, but slices may keep the storage alive.
+  bufferwrap->jobject = jerry_create_undefined();
+  iotjs_bufferwrap_unref(bufferwrap);
 }
 
 
@@ -83,7 +304,7 @@ size_t iotjs_bufferwrap_length(iotjs_bufferwrap_t* bufferwrap) {
   }
 #ifndef NDEBUG
   jerry_value_t jlength =
-      iotjs_jval_get_property(bufferwrap->jobject, IOTJS_MAGIC_STRING_LENGTH);
+      iotjs_jval_get_property_by_key(bufferwrap->jobject, IOTJS_KEY(LENGTH));
   size_t length = iotjs_jval_as_number(jlength);
   IOTJS_ASSERT(length == bufferwrap->length);
   jerry_release_value(jlength);
@@ -119,154 +340,559 @@ static size_t bound_range(size_t index, size_t low, size_t upper) {
 }
 
 
-static int8_t hex_to_bin(char c) {
-  if (c >= '0' && c <= '9') {
-    return (int8_t)(c - '0');
-  }
-  if (c >= 'A' && c <= 'F') {
-    return (int8_t)(10 + (c - 'A'));
+// Decoding tables map every input character to its value, invalid
+// characters map to 0xff. Valid values never have the top bit set, so
+// a block can be validated once by or-ing the values looked up.
+static const uint8_t hex_dec_map[256] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t base64_dec_map[256] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+  0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24,
+  0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+  0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff
+};
+
+static const unsigned char base64_enc_map[65] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+
+// Vector kernels handle the bulk of the input and return the number of
+// units (bytes for hex, three byte groups for base64) they processed.
+// They stop in front of a block containing invalid characters, so the
+// scalar code finishing the input is the one that reports the error.
+#if defined(BUFFER_CODEC_SSE2)
+
+static __m128i hex_chars_sse2(__m128i nibbles) {
+  __m128i letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+  __m128i chars = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+  return _mm_add_epi8(chars,
+                      _mm_and_si128(letters, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+
+static size_t hex_encode_simd(char* dst, const uint8_t* src, size_t length) {
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  size_t i = 0;
+
+  for (; i + 16 <= length; i += 16) {
+    __m128i bytes = _mm_loadu_si128((const __m128i*)(src + i));
+    __m128i hi = hex_chars_sse2(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+    __m128i lo = hex_chars_sse2(_mm_and_si128(bytes, mask));
+
+    _mm_storeu_si128((__m128i*)(dst + 2 * i), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i*)(dst + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
   }
-  if (c >= 'a' && c <= 'f') {
-    return (int8_t)(10 + (c - 'a'));
+
+  return i;
+}
+
+
+static __m128i hex_values_sse2(__m128i chars, __m128i* valid) {
+  __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+  __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                _mm_set1_epi8('a'));
+  __m128i is_digit =
+      _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  __m128i is_letter =
+      _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+  *valid = _mm_and_si128(*valid, _mm_or_si128(is_digit, is_letter));
+
+  letter = _mm_add_epi8(letter, _mm_set1_epi8(10));
+  return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                      _mm_and_si128(is_letter, letter));
+}
+
+
+static __m128i hex_pack_sse2(__m128i values) {
+  // Every 16 bit lane holds the high nibble in its low byte.
+  __m128i hi = _mm_and_si128(values, _mm_set1_epi16(0xff));
+  return _mm_or_si128(_mm_slli_epi16(hi, 4), _mm_srli_epi16(values, 8));
+}
+
+
+static size_t hex_decode_simd(uint8_t* dst, const uint8_t* src,
+                              size_t length) {
+  size_t i = 0;
+
+  for (; i + 16 <= length; i += 16) {
+    __m128i valid = _mm_set1_epi8(-1);
+    __m128i first = _mm_loadu_si128((const __m128i*)(src + 2 * i));
+    __m128i second = _mm_loadu_si128((const __m128i*)(src + 2 * i + 16));
+
+    first = hex_values_sse2(first, &valid);
+    second = hex_values_sse2(second, &valid);
+
+    if (_mm_movemask_epi8(valid) != 0xffff) {
+      break;
+    }
+
+    _mm_storeu_si128((__m128i*)(dst + i),
+                     _mm_packus_epi16(hex_pack_sse2(first),
+                                      hex_pack_sse2(second)));
   }
 
-  return (int8_t)(-1);
+  return i;
 }
 
 
-static size_t hex_decode(char* buf, size_t len, const char* src,
-                         const size_t src_len) {
-  const char* buf_start = buf;
-  const char* buf_end = buf + len;
-  const char* src_end = src + src_len;
+static __m128i base64_shift_sse2(__m128i chars, __m128i indices, char above,
+                                 char offset) {
+  __m128i mask = _mm_cmpgt_epi8(indices, _mm_set1_epi8(above));
+  return _mm_add_epi8(chars, _mm_and_si128(mask, _mm_set1_epi8(offset)));
+}
 
-  if ((src_len & 0x1) != 0) {
-    return 0;
+
+static size_t base64_encode_simd(unsigned char* dst, const uint8_t* src,
+                                 size_t groups) {
+  const __m128i mask = _mm_set1_epi32(0x3f);
+  size_t i = 0;
+
+  for (; i + 4 <= groups; i += 4) {
+    const uint8_t* in = src + 3 * i;
+    __m128i bits = _mm_setr_epi32((in[0] << 16) | (in[1] << 8) | in[2],
+                                  (in[3] << 16) | (in[4] << 8) | in[5],
+                                  (in[6] << 16) | (in[7] << 8) | in[8],
+                                  (in[9] << 16) | (in[10] << 8) | in[11]);
+
+    // Spread the four indices of a group over the bytes of its lane.
+    __m128i c1 = _mm_and_si128(_mm_srli_epi32(bits, 12), mask);
+    __m128i c2 = _mm_and_si128(_mm_srli_epi32(bits, 6), mask);
+    __m128i c3 = _mm_and_si128(bits, mask);
+    __m128i indices = _mm_or_si128(_mm_srli_epi32(bits, 18),
+                                   _mm_slli_epi32(c1, 8));
+    indices = _mm_or_si128(indices, _mm_slli_epi32(c2, 16));
+    indices = _mm_or_si128(indices, _mm_slli_epi32(c3, 24));
+
+    // 'A'-'Z', 'a'-'z', '0'-'9', '+' and '/' are reached by offsets.
+    __m128i chars = _mm_add_epi8(indices, _mm_set1_epi8('A'));
+    chars = base64_shift_sse2(chars, indices, 25, 'a' - 'A' - 26);
+    chars = base64_shift_sse2(chars, indices, 51, '0' - 'a' - 26);
+    chars = base64_shift_sse2(chars, indices, 61, '+' - '0' - 10);
+    chars = base64_shift_sse2(chars, indices, 62, '/' - '+' - 1);
+
+    _mm_storeu_si128((__m128i*)(dst + 4 * i), chars);
   }
 
-  while (src < src_end) {
-    int8_t a = hex_to_bin(src[0]);
-    int8_t b = hex_to_bin(src[1]);
+  return i;
+}
+
 
-    if (a == -1 || b == -1) {
-      return 0;
+static __m128i base64_range_sse2(__m128i chars, char first, char last,
+                                 char value, __m128i* values) {
+  __m128i offset = _mm_sub_epi8(chars, _mm_set1_epi8(first));
+  __m128i limit = _mm_set1_epi8((char)(last - first));
+  __m128i in_range = _mm_cmpeq_epi8(_mm_min_epu8(offset, limit), offset);
+
+  offset = _mm_add_epi8(offset, _mm_set1_epi8(value));
+  *values = _mm_or_si128(*values, _mm_and_si128(in_range, offset));
+  return in_range;
+}
+
+
+static size_t base64_decode_simd(uint8_t* dst, const uint8_t* src,
+                                 size_t groups) {
+  uint32_t bits[4];
+  size_t i = 0;
+
+  for (; i + 4 <= groups; i += 4) {
+    __m128i chars = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+    __m128i values = _mm_setzero_si128();
+    __m128i valid = base64_range_sse2(chars, 'A', 'Z', 0, &values);
+    valid = _mm_or_si128(valid,
+                         base64_range_sse2(chars, 'a', 'z', 26, &values));
+    valid = _mm_or_si128(valid,
+                         base64_range_sse2(chars, '0', '9', 52, &values));
+    valid = _mm_or_si128(valid,
+                         base64_range_sse2(chars, '+', '+', 62, &values));
+    valid = _mm_or_si128(valid,
+                         base64_range_sse2(chars, '/', '/', 63, &values));
+
+    if (_mm_movemask_epi8(valid) != 0xffff) {
+      break;
     }
 
-    if (buf < buf_end) {
-      *buf++ = (a << 4) | b;
+    // Merge the four 6 bit values of every 32 bit lane into 24 bits.
+    __m128i pairs = _mm_or_si128(
+        _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0xff)), 6),
+        _mm_srli_epi16(values, 8));
+    pairs = _mm_or_si128(
+        _mm_slli_epi32(_mm_and_si128(pairs, _mm_set1_epi32(0xffff)), 12),
+        _mm_srli_epi32(pairs, 16));
+    _mm_storeu_si128((__m128i*)bits, pairs);
+
+    uint8_t* out = dst + 3 * i;
+    for (int k = 0; k < 4; k++) {
+      *out++ = (uint8_t)(bits[k] >> 16);
+      *out++ = (uint8_t)(bits[k] >> 8);
+      *out++ = (uint8_t)bits[k];
     }
+  }
+
+  return i;
+}
+
+#elif defined(BUFFER_CODEC_NEON)
+
+static uint8x16_t hex_chars_neon(uint8x16_t nibbles) {
+  uint8x16_t letters = vcgtq_u8(nibbles, vdupq_n_u8(9));
+  uint8x16_t chars = vaddq_u8(nibbles, vdupq_n_u8('0'));
+  return vaddq_u8(chars, vandq_u8(letters, vdupq_n_u8('a' - '0' - 10)));
+}
 
-    src += 2;
+
+static size_t hex_encode_simd(char* dst, const uint8_t* src, size_t length) {
+  size_t i = 0;
+
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t bytes = vld1q_u8(src + i);
+    uint8x16x2_t chars;
+
+    chars.val[0] = hex_chars_neon(vshrq_n_u8(bytes, 4));
+    chars.val[1] = hex_chars_neon(vandq_u8(bytes, vdupq_n_u8(0x0f)));
+    vst2q_u8((uint8_t*)(dst + 2 * i), chars);
   }
 
-  return (size_t)((buf - buf_start) + 1);
+  return i;
+}
+
+
+static bool all_lanes_set_neon(uint8x16_t mask) {
+  uint8x8_t folded = vpmin_u8(vget_low_u8(mask), vget_high_u8(mask));
+  folded = vpmin_u8(folded, folded);
+  folded = vpmin_u8(folded, folded);
+  folded = vpmin_u8(folded, folded);
+  return vget_lane_u8(folded, 0) == 0xff;
+}
+
+
+static uint8x16_t hex_values_neon(uint8x16_t chars, uint8x16_t* valid) {
+  uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+  uint8x16_t letter =
+      vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  uint8x16_t is_digit = vcleq_u8(digit, vdupq_n_u8(9));
+  uint8x16_t is_letter = vcleq_u8(letter, vdupq_n_u8(5));
+
+  *valid = vandq_u8(*valid, vorrq_u8(is_digit, is_letter));
+
+  return vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
 }
 
 
-static int32_t base64_to_bin(char c) {
-  if (c >= 'A' && c <= 'Z') {
-    return (int32_t)(c - 'A');
+static size_t hex_decode_simd(uint8_t* dst, const uint8_t* src,
+                              size_t length) {
+  size_t i = 0;
+
+  for (; i + 16 <= length; i += 16) {
+    uint8x16x2_t chars = vld2q_u8(src + 2 * i);
+    uint8x16_t valid = vdupq_n_u8(0xff);
+    uint8x16_t hi = hex_values_neon(chars.val[0], &valid);
+    uint8x16_t lo = hex_values_neon(chars.val[1], &valid);
+
+    if (!all_lanes_set_neon(valid)) {
+      break;
+    }
+
+    vst1q_u8(dst + i, vorrq_u8(vshlq_n_u8(hi, 4), lo));
   }
-  if (c >= 'a' && c <= 'z') {
-    return (int32_t)(26 + (c - 'a'));
+
+  return i;
+}
+
+
+static uint8x16_t base64_shift_neon(uint8x16_t chars, uint8x16_t indices,
+                                    uint8_t above, uint8_t offset) {
+  uint8x16_t mask = vcgtq_u8(indices, vdupq_n_u8(above));
+  return vaddq_u8(chars, vandq_u8(mask, vdupq_n_u8(offset)));
+}
+
+
+static uint8x16_t base64_chars_neon(uint8x16_t indices) {
+  // 'A'-'Z', 'a'-'z', '0'-'9', '+' and '/' are reached by offsets.
+  uint8x16_t chars = vaddq_u8(indices, vdupq_n_u8('A'));
+  chars = base64_shift_neon(chars, indices, 25, (uint8_t)('a' - 'A' - 26));
+  chars = base64_shift_neon(chars, indices, 51, (uint8_t)('0' - 'a' - 26));
+  chars = base64_shift_neon(chars, indices, 61, (uint8_t)('+' - '0' - 10));
+  chars = base64_shift_neon(chars, indices, 62, (uint8_t)('/' - '+' - 1));
+  return chars;
+}
+
+
+static size_t base64_encode_simd(unsigned char* dst, const uint8_t* src,
+                                 size_t groups) {
+  const uint8x16_t mask = vdupq_n_u8(0x3f);
+  size_t i = 0;
+
+  for (; i + 16 <= groups; i += 16) {
+    uint8x16x3_t in = vld3q_u8(src + 3 * i);
+    uint8x16x4_t out;
+
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+                                   vshrq_n_u8(in.val[1], 4)),
+                          mask);
+    out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+                                   vshrq_n_u8(in.val[2], 6)),
+                          mask);
+    out.val[3] = vandq_u8(in.val[2], mask);
+
+    for (int k = 0; k < 4; k++) {
+      out.val[k] = base64_chars_neon(out.val[k]);
+    }
+    vst4q_u8(dst + 4 * i, out);
   }
-  if (c >= '0' && c <= '9') {
-    return (int32_t)(52 + (c - '0'));
+
+  return i;
+}
+
+
+static uint8x16_t base64_range_neon(uint8x16_t chars, uint8_t first,
+                                    uint8_t last, uint8_t value,
+                                    uint8x16_t* values) {
+  uint8x16_t offset = vsubq_u8(chars, vdupq_n_u8(first));
+  uint8x16_t in_range = vcleq_u8(offset, vdupq_n_u8((uint8_t)(last - first)));
+
+  offset = vaddq_u8(offset, vdupq_n_u8(value));
+  *values = vorrq_u8(*values, vandq_u8(in_range, offset));
+  return in_range;
+}
+
+
+static uint8x16_t base64_values_neon(uint8x16_t chars, uint8x16_t* valid) {
+  uint8x16_t values = vdupq_n_u8(0);
+  uint8x16_t found = base64_range_neon(chars, 'A', 'Z', 0, &values);
+  found = vorrq_u8(found, base64_range_neon(chars, 'a', 'z', 26, &values));
+  found = vorrq_u8(found, base64_range_neon(chars, '0', '9', 52, &values));
+  found = vorrq_u8(found, base64_range_neon(chars, '+', '+', 62, &values));
+  found = vorrq_u8(found, base64_range_neon(chars, '/', '/', 63, &values));
+
+  *valid = vandq_u8(*valid, found);
+  return values;
+}
+
+
+static size_t base64_decode_simd(uint8_t* dst, const uint8_t* src,
+                                 size_t groups) {
+  size_t i = 0;
+
+  for (; i + 16 <= groups; i += 16) {
+    uint8x16x4_t in = vld4q_u8(src + 4 * i);
+    uint8x16_t valid = vdupq_n_u8(0xff);
+    uint8x16x3_t out;
+
+    for (int k = 0; k < 4; k++) {
+      in.val[k] = base64_values_neon(in.val[k], &valid);
+    }
+
+    if (!all_lanes_set_neon(valid)) {
+      break;
+    }
+
+    out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+    vst3q_u8(dst + 3 * i, out);
   }
-  if (c == '+') {
-    return 62;
+
+  return i;
+}
+
+#else /* !BUFFER_CODEC_SSE2 && !BUFFER_CODEC_NEON */
+
+#define hex_encode_simd(dst, src, length) ((size_t)0)
+#define hex_decode_simd(dst, src, length) ((size_t)0)
+#define base64_encode_simd(dst, src, groups) ((size_t)0)
+#define base64_decode_simd(dst, src, groups) ((size_t)0)
+
+#endif /* BUFFER_CODEC_SSE2 */
+
+
+static size_t hex_decode(char* buf, size_t len, const char* src,
+                         const size_t src_len) {
+  if ((src_len & 0x1) != 0) {
+    return 0;
   }
-  if (c == '/') {
-    return 63;
+
+  const uint8_t* in = (const uint8_t*)src;
+  uint8_t* out = (uint8_t*)buf;
+  size_t out_len = src_len / 2;
+
+  if (out_len > len) {
+    out_len = len;
   }
 
-  return (int32_t)(-1);
-}
+  size_t i = hex_decode_simd(out, in, out_len);
+  uint8_t invalid = 0;
 
+  for (; i < out_len; i++) {
+    uint8_t hi = hex_dec_map[in[2 * i]];
+    uint8_t lo = hex_dec_map[in[2 * i + 1]];
 
-static size_t base64_decode(char* dst, size_t len, const char* src,
-                            const size_t srcLen) {
-  if (srcLen == 0) {
-    return 1;
+    invalid |= hi | lo;
+    out[i] = (uint8_t)((hi << 4) | lo);
   }
 
-  char* decoded_base64 = NULL;
-  size_t decoded_len = iotjs_base64_decode(&decoded_base64, src, srcLen);
-  size_t ret_val = 0;
-  if (decoded_len) {
-    char* buf = dst;
-    char* bufEnd = len > decoded_len ? dst + decoded_len : dst + len;
+  // Characters which do not fit into the buffer must be valid as well.
+  for (i = 2 * out_len; i < src_len; i++) {
+    invalid |= hex_dec_map[in[i]];
+  }
 
-    char* pos = decoded_base64;
-    while (buf < bufEnd) {
-      *buf++ = *pos++;
-    }
-    ret_val = (size_t)(buf - dst) + 1;
+  if (invalid & 0x80) {
+    return 0;
   }
 
-  IOTJS_RELEASE(decoded_base64);
-  return ret_val;
+  return out_len + 1;
 }
 
 
-size_t iotjs_base64_decode(char** out_buff, const char* src,
-                           const size_t srcLen) {
-  if ((srcLen & 0x3) != 0 || srcLen == 0) {
+static size_t base64_padding(const char* src, size_t src_len) {
+  if (src[src_len - 1] != '=') {
     return 0;
   }
+  return (src[src_len - 2] == '=') ? 2 : 1;
+}
+
 
-  size_t len = (3 * (srcLen / 4));
+static void base64_store_group(uint8_t* dst, size_t len, size_t pos,
+                               uint32_t bits, size_t count) {
+  for (size_t k = 0; k < count && pos + k < len; k++) {
+    dst[pos + k] = (uint8_t)(bits >> (16 - 8 * k));
+  }
+}
 
-  const char* src_end = src + srcLen;
 
-  if (src_end[-1] == '=') {
-    src_end--;
-    len--;
-    if (src_end[-1] == '=') {
-      src_end--;
-      len--;
+// Decodes |src_len| characters, a non-zero multiple of four, into at most
+// |len| bytes of |dst|. The whole input is validated regardless of |len|.
+// Returns the decoded length, or zero for invalid input.
+static size_t base64_decode_groups(uint8_t* dst, size_t len,
+                                   const uint8_t* src, size_t src_len) {
+  size_t padding = base64_padding((const char*)src, src_len);
+  size_t groups = src_len / 4 - 1;
+  size_t stored = len / 3;
+
+  if (stored > groups) {
+    stored = groups;
+  }
+
+  size_t i = base64_decode_simd(dst, src, stored);
+  uint8_t invalid = 0;
+
+  for (; i < groups; i++) {
+    const uint8_t* in = src + 4 * i;
+    uint8_t a = base64_dec_map[in[0]];
+    uint8_t b = base64_dec_map[in[1]];
+    uint8_t c = base64_dec_map[in[2]];
+    uint8_t d = base64_dec_map[in[3]];
+    uint32_t bits = ((uint32_t)a << 18) | ((uint32_t)b << 12) |
+                    ((uint32_t)c << 6) | d;
+
+    invalid |= a | b | c | d;
+
+    if (i < stored) {
+      dst[3 * i] = (uint8_t)(bits >> 16);
+      dst[3 * i + 1] = (uint8_t)(bits >> 8);
+      dst[3 * i + 2] = (uint8_t)bits;
+    } else {
+      base64_store_group(dst, len, 3 * i, bits, 3);
     }
   }
 
-  if (*out_buff == NULL) {
-    *out_buff = IOTJS_CALLOC(len, char);
+  // The last group may end with padding characters.
+  const uint8_t* in = src + 4 * groups;
+  uint8_t a = base64_dec_map[in[0]];
+  uint8_t b = base64_dec_map[in[1]];
+  uint8_t c = padding < 2 ? base64_dec_map[in[2]] : 0;
+  uint8_t d = padding < 1 ? base64_dec_map[in[3]] : 0;
+  uint32_t bits = ((uint32_t)a << 18) | ((uint32_t)b << 12) |
+                  ((uint32_t)c << 6) | d;
+
+  invalid |= a | b | c | d;
+  base64_store_group(dst, len, 3 * groups, bits, 3 - padding);
+
+  if (invalid & 0x80) {
+    return 0;
   }
 
-  char* buf = *out_buff;
+  return 3 * (groups + 1) - padding;
+}
 
-  const char* bufStart = buf;
-  const char* bufEnd = buf + len;
 
-  int32_t current_bits = 0;
-  int32_t shift = 8;
+static size_t base64_decode(char* dst, size_t len, const char* src,
+                            const size_t srcLen) {
+  if (srcLen == 0) {
+    return 1;
+  }
 
-  while (src < src_end) {
-    int32_t value = base64_to_bin(*src++);
+  if ((srcLen & 0x3) != 0) {
+    return 0;
+  }
 
-    if (value == -1) {
-      return 0;
-    }
+  size_t decoded_len =
+      base64_decode_groups((uint8_t*)dst, len, (const uint8_t*)src, srcLen);
 
-    current_bits = (current_bits << 6) | value;
-    shift -= 2;
+  if (decoded_len == 0) {
+    return 0;
+  }
 
-    if (shift == 6) {
-      continue;
-    }
+  return (decoded_len < len ? decoded_len : len) + 1;
+}
 
-    int32_t byte = (current_bits >> shift);
-    current_bits &= (1 << shift) - 1;
 
-    if (shift == 0) {
-      shift = 8;
-    }
+size_t iotjs_base64_decode(char** out_buff, const char* src,
+                           const size_t srcLen) {
+  if ((srcLen & 0x3) != 0 || srcLen == 0) {
+    return 0;
+  }
 
-    if (buf <= bufEnd) {
-      *buf++ = byte;
-    }
+  size_t len = 3 * (srcLen / 4) - base64_padding(src, srcLen);
+
+  if (*out_buff == NULL) {
+    *out_buff = IOTJS_CALLOC(len, char);
   }
 
-  return (size_t)((buf - bufStart));
+  return base64_decode_groups((uint8_t*)*out_buff, len, (const uint8_t*)src,
+                              srcLen);
 }
 
 
@@ -321,65 +947,224 @@ size_t iotjs_bufferwrap_copy_internal(iotjs_bufferwrap_t* bufferwrap,
 }
 
 
-size_t iotjs_bufferwrap_copy(iotjs_bufferwrap_t* bufferwrap, const char* src,
-                             size_t len) {
-  return iotjs_bufferwrap_copy_internal(bufferwrap, src, 0, len, 0);
-}
+size_t iotjs_bufferwrap_copy(iotjs_bufferwrap_t* bufferwrap, const char* src,
+                             size_t len) {
+  return iotjs_bufferwrap_copy_internal(bufferwrap, src, 0, len, 0);
+}
+
+static size_t index_normalizer(int64_t index, size_t max_length) {
+  size_t idx;
+  if (index < 0) {
+    if ((size_t)(-index) > max_length) {
+      idx = SIZE_MAX;
+    } else {
+      idx = (size_t)index + max_length;
+    }
+  } else {
+    idx = (size_t)index;
+  }
+
+  return bound_range(idx, 0, max_length);
+}
+
+// Buffer.prototype, looked up once the JS module has registered Buffer.
+static jerry_value_t buffer_prototype = 0;
+
+
+static jerry_value_t iotjs_bufferwrap_get_prototype(void) {
+  if (buffer_prototype != 0) {
+    return buffer_prototype;
+  }
+
+  jerry_value_t native_buffer = iotjs_module_get("buffer");
+  jerry_value_t jbuffer =
+      iotjs_jval_get_property(native_buffer, IOTJS_MAGIC_STRING_BUFFER);
+
+  if (!jerry_value_is_error(jbuffer) && jerry_value_is_object(jbuffer)) {
+    jerry_value_t jbuffer_proto =
+        iotjs_jval_get_property(jbuffer, IOTJS_MAGIC_STRING_PROTOTYPE);
+
+    if (!jerry_value_is_error(jbuffer_proto) &&
+        jerry_value_is_object(jbuffer_proto)) {
+      buffer_prototype = jbuffer_proto;
+    } else {
+      jerry_release_value(jbuffer_proto);
+    }
+  }
+  jerry_release_value(jbuffer);
+
+  return buffer_prototype;
+}
+
+
+static jerry_value_t iotjs_bufferwrap_create_jbuffer(size_t len) {
+  jerry_value_t jres_buffer = jerry_create_object();
+
+  iotjs_jval_set_property_number_by_key(jres_buffer, IOTJS_KEY(LENGTH), len);
+
+  // Support for 'instanceof' operator
+  jerry_value_t jbuffer_proto = iotjs_bufferwrap_get_prototype();
+  if (jbuffer_proto != 0) {
+    jerry_set_prototype(jres_buffer, jbuffer_proto);
+  }
+
+  return jres_buffer;
+}
+
+
+void iotjs_bufferwrap_prototype_cleanup(void) {
+  if (buffer_prototype != 0) {
+    jerry_release_value(buffer_prototype);
+    buffer_prototype = 0;
+  }
+}
+
+
+jerry_value_t iotjs_bufferwrap_create_buffer(size_t len) {
+  jerry_value_t jres_buffer = iotjs_bufferwrap_create_jbuffer(len);
+
+  iotjs_bufferwrap_create(jres_buffer, len);
+
+  return jres_buffer;
+}
+
+
+jerry_value_t iotjs_bufferwrap_create_buffer_uninitialized(size_t len) {
+  jerry_value_t jres_buffer = iotjs_bufferwrap_create_jbuffer(len);
+
+  iotjs_bufferwrap_create_internal(jres_buffer, len, false);
+
+  return jres_buffer;
+}
+
+
+jerry_value_t iotjs_bufferwrap_create_buffer_slice(iotjs_bufferwrap_t* source,
+                                                   size_t offset, size_t len) {
+  jerry_value_t jres_buffer = iotjs_bufferwrap_create_jbuffer(len);
 
-static size_t index_normalizer(int64_t index, size_t max_length) {
-  size_t idx;
-  if (index < 0) {
-    if ((size_t)(-index) > max_length) {
-      idx = SIZE_MAX;
-    } else {
-      idx = (size_t)index + max_length;
-    }
-  } else {
-    idx = (size_t)index;
-  }
+  iotjs_bufferwrap_create_slice(jres_buffer, source, offset, len);
 
-  return bound_range(idx, 0, max_length);
+  return jres_buffer;
 }
 
-jerry_value_t iotjs_bufferwrap_create_buffer(size_t len) {
-  jerry_value_t jres_buffer = jerry_create_object();
 
-  iotjs_bufferwrap_create(jres_buffer, len);
+jerry_value_t iotjs_bufferwrap_create_buffer_from_string(
+    const jerry_value_t jstring) {
+  IOTJS_ASSERT(jerry_value_is_string(jstring));
 
-  iotjs_jval_set_property_number(jres_buffer, IOTJS_MAGIC_STRING_LENGTH, len);
+  jerry_size_t size = jerry_get_utf8_string_size(jstring);
+  jerry_value_t jres_buffer =
+      iotjs_bufferwrap_create_buffer_uninitialized(size);
+  iotjs_bufferwrap_t* buffer_wrap = iotjs_bufferwrap_from_jbuffer(jres_buffer);
 
-  // Support for 'instanceof' operator
-  jerry_value_t native_buffer = iotjs_module_get("buffer");
-  jerry_value_t jbuffer =
-      iotjs_jval_get_property(native_buffer, IOTJS_MAGIC_STRING_BUFFER);
+  jerry_char_t* dst = (jerry_char_t*)buffer_wrap->buffer;
+  size_t check = jerry_string_to_utf8_char_buffer(jstring, dst, size);
+  IOTJS_ASSERT(check == size);
 
-  if (!jerry_value_is_error(jbuffer) && jerry_value_is_object(jbuffer)) {
-    jerry_value_t jbuffer_proto =
-        iotjs_jval_get_property(jbuffer, IOTJS_MAGIC_STRING_PROTOTYPE);
+  return jres_buffer;
+}
 
-    if (!jerry_value_is_error(jbuffer_proto) &&
-        jerry_value_is_object(jbuffer_proto)) {
-      jerry_set_prototype(jres_buffer, jbuffer_proto);
+
+char* iotjs_bufferwrap_slab_allocate(size_t size) {
+  IOTJS_ASSERT(size <= IOTJS_BUFFER_SLAB_SIZE);
+
+  iotjs_bufferwrap_t* slab = buffer_slab.bufferwrap;
+
+  if (slab == NULL || slab->length - buffer_slab.used < size) {
+    if (slab != NULL) {
+      // Slices handed out earlier keep the old slab alive.
+      iotjs_bufferwrap_unref(slab);
     }
 
-    jerry_release_value(jbuffer_proto);
+    slab = buffer_pool_alloc(IOTJS_BUFFER_SLAB_SIZE, false);
+    slab->jobject = jerry_create_undefined();
+    slab->buffer = slab->storage;
+    slab->length = IOTJS_BUFFER_SLAB_SIZE;
+    slab->refcount = 1;
+
+    buffer_slab.bufferwrap = slab;
+    buffer_slab.used = 0;
   }
-  jerry_release_value(jbuffer);
 
-  return jres_buffer;
+  return slab->buffer + buffer_slab.used;
+}
+
+
+jerry_value_t iotjs_bufferwrap_slab_create_buffer(const char* data,
+                                                  size_t len) {
+  iotjs_bufferwrap_t* slab = buffer_slab.bufferwrap;
+  size_t offset = buffer_slab.used;
+
+  IOTJS_ASSERT(slab != NULL && data == slab->buffer + offset);
+  IOTJS_ASSERT(offset + len <= slab->length);
+
+  buffer_slab.used += len;
+  return iotjs_bufferwrap_create_buffer_slice(slab, offset, len);
 }
 
 
 JS_FUNCTION(buffer_constructor) {
   DJS_CHECK_ARGS(2, object, number);
+  DJS_CHECK_ARG_IF_EXIST(2, boolean);
 
   const jerry_value_t jobject = JS_GET_ARG(0, object);
   size_t length = JS_GET_ARG(1, number);
+  // The caller overwrites the whole content if the storage is uninitialized.
+  bool uninitialized = jargc > 2 && JS_GET_ARG(2, boolean);
 
-  iotjs_bufferwrap_create(jobject, length);
+  iotjs_bufferwrap_create_internal(jobject, length, !uninitialized);
   return jerry_create_undefined();
 }
 
+
+JS_FUNCTION(buffer_alloc_unsafe) {
+  DJS_CHECK_ARGS(1, number);
+
+  size_t length = iotjs_convert_double_to_sizet(JS_GET_ARG(0, number));
+  if (length == SIZE_MAX) {
+    length = 0;
+  }
+
+  return iotjs_bufferwrap_create_buffer_uninitialized(length);
+}
+
+
+JS_FUNCTION(buffer_pool_stats) {
+  jerry_value_t jstats = jerry_create_object();
+  jerry_value_t jclasses = jerry_create_array(IOTJS_BUFFER_POOL_CLASS_COUNT);
+
+  for (uint32_t i = 0; i < IOTJS_BUFFER_POOL_CLASS_COUNT; i++) {
+    buffer_pool_class_t* pool_class = &buffer_pool.classes[i];
+    jerry_value_t jclass = jerry_create_object();
+
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_SIZE,
+                                   IOTJS_BUFFER_POOL_MIN_SIZE << i);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_LIVE,
+                                   pool_class->live);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_POOLED,
+                                   pool_class->pooled);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_HITS,
+                                   pool_class->hits);
+    iotjs_jval_set_property_number(jclass, IOTJS_MAGIC_STRING_MISSES,
+                                   pool_class->misses);
+
+    iotjs_jval_set_property_by_index(jclasses, i, jclass);
+    jerry_release_value(jclass);
+  }
+
+  iotjs_jval_set_property_jval(jstats, IOTJS_MAGIC_STRING_CLASSES, jclasses);
+  jerry_release_value(jclasses);
+
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_POOLEDBYTES,
+                                 buffer_pool.pooled_bytes);
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_MAXPOOLEDBYTES,
+                                 IOTJS_BUFFER_POOL_MAX_BYTES);
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_LARGELIVE,
+                                 buffer_pool.large_live);
+
+  return jstats;
+}
+
 JS_FUNCTION(buffer_compare) {
   JS_DECLARE_OBJECT_PTR(0, bufferwrap, src_buffer_wrap);
   JS_DECLARE_OBJECT_PTR(1, bufferwrap, dst_buffer_wrap);
@@ -421,11 +1206,75 @@ JS_FUNCTION(buffer_copy) {
 }
 
 
+static iotjs_bufferwrap_t* buffer_concat_get_item(const jerry_value_t jlist,
+                                                  uint32_t index) {
+  // The list keeps the item alive, the reference can be dropped here.
+  jerry_value_t jitem = jerry_get_property_by_index(jlist, index);
+  iotjs_bufferwrap_t* item_wrap = iotjs_jbuffer_get_bufferwrap_ptr(jitem);
+  jerry_release_value(jitem);
+
+  return item_wrap;
+}
+
+
+JS_FUNCTION(buffer_concat) {
+  DJS_CHECK_ARGS(1, array);
+  DJS_CHECK_ARG_IF_EXIST(1, number);
+
+  const jerry_value_t jlist = jargv[0];
+  uint32_t count = jerry_get_array_length(jlist);
+  size_t total_length = 0;
+
+  if (jargc > 1 && jerry_value_is_number(jargv[1])) {
+    total_length = iotjs_convert_double_to_sizet(JS_GET_ARG(1, number));
+  } else {
+    for (uint32_t i = 0; i < count; i++) {
+      iotjs_bufferwrap_t* item_wrap = buffer_concat_get_item(jlist, i);
+
+      if (item_wrap == NULL) {
+        return JS_CREATE_ERROR(TYPE, "Bad arguments: Buffer.concat([Buffer])");
+      }
+      total_length += item_wrap->length;
+    }
+  }
+
+  jerry_value_t jres_buffer =
+      iotjs_bufferwrap_create_buffer_uninitialized(total_length);
+  iotjs_bufferwrap_t* res_wrap = iotjs_bufferwrap_from_jbuffer(jres_buffer);
+  char* dst = res_wrap->buffer;
+  size_t remaining = total_length;
+
+  for (uint32_t i = 0; i < count; i++) {
+    iotjs_bufferwrap_t* item_wrap = buffer_concat_get_item(jlist, i);
+
+    if (item_wrap == NULL) {
+      jerry_release_value(jres_buffer);
+      return JS_CREATE_ERROR(TYPE, "Bad arguments: Buffer.concat([Buffer])");
+    }
+
+    size_t length = item_wrap->length;
+    if (length > remaining) {
+      length = remaining;
+    }
+
+    memcpy(dst, item_wrap->buffer, length);
+    dst += length;
+    remaining -= length;
+  }
+
+  // Bytes past the end of the list when totalLength is larger.
+  memset(dst, 0, remaining);
+
+  return jres_buffer;
+}
+
+
 JS_FUNCTION(buffer_write) {
   DJS_CHECK_ARGS(4, object, string, number, number);
   JS_DECLARE_OBJECT_PTR(0, bufferwrap, buffer_wrap);
 
-  iotjs_string_t src = JS_GET_ARG(1, string);
+  const jerry_value_t jstring = jargv[1];
+  jerry_size_t size = jerry_get_utf8_string_size(jstring);
 
   size_t buffer_length = iotjs_bufferwrap_length(buffer_wrap);
   size_t offset = iotjs_convert_double_to_sizet(JS_GET_ARG(2, number));
@@ -433,13 +1282,23 @@ JS_FUNCTION(buffer_write) {
 
   size_t length = iotjs_convert_double_to_sizet(JS_GET_ARG(3, number));
   length = bound_range(length, 0, buffer_length - offset);
-  length = bound_range(length, 0, iotjs_string_size(&src));
+  length = bound_range(length, 0, size);
 
-  const char* src_data = iotjs_string_data(&src);
-  size_t copied =
-      iotjs_bufferwrap_copy_internal(buffer_wrap, src_data, 0, length, offset);
+  char* dst = buffer_wrap->buffer + offset;
+  size_t copied;
 
-  iotjs_string_destroy(&src);
+  if (length == size) {
+    // The whole string fits, encode it straight into the buffer.
+    copied = jerry_string_to_utf8_char_buffer(jstring, (jerry_char_t*)dst,
+                                              (jerry_size_t)length);
+  } else {
+    // Only a prefix fits, which may end in the middle of a character.
+    iotjs_stack_string_t src;
+    iotjs_jval_as_stack_string(jstring, &src);
+    memcpy(dst, src.data, length);
+    iotjs_free_stack_string(&src);
+    copied = length;
+  }
 
   return jerry_create_number(copied);
 }
@@ -521,6 +1380,378 @@ JS_FUNCTION(buffer_read_uint8) {
 }
 
 
+static uint64_t buffer_load_bytes(const uint8_t* src, size_t size,
+                                  bool little_endian) {
+  uint64_t bits = 0;
+  for (size_t i = 0; i < size; i++) {
+    bits = (bits << 8) | src[little_endian ? size - 1 - i : i];
+  }
+  return bits;
+}
+
+
+static void buffer_store_bytes(uint8_t* dst, uint64_t bits, size_t size,
+                               bool little_endian) {
+  for (size_t i = 0; i < size; i++) {
+    dst[little_endian ? i : size - 1 - i] = (uint8_t)bits;
+    bits >>= 8;
+  }
+}
+
+
+// Converts the value the same way as the ToUint32 operation of ECMAScript.
+static uint32_t buffer_number_to_uint32(double value) {
+  if (isnan(value) || isinf(value)) {
+    return 0;
+  }
+
+  value = fmod(trunc(value), 4294967296.0);
+  if (value < 0) {
+    value += 4294967296.0;
+  }
+  return (uint32_t)value;
+}
+
+
+// Returns how many bytes of a `size` long value at `joffset` are inside the
+// buffer.
+static size_t buffer_get_number_bytes(iotjs_bufferwrap_t* buffer_wrap,
+                                      jerry_value_t joffset, size_t size,
+                                      size_t* offset) {
+  size_t buffer_length = iotjs_bufferwrap_length(buffer_wrap);
+  *offset = iotjs_convert_double_to_sizet(iotjs_jval_as_number(joffset));
+
+  if (*offset >= buffer_length) {
+    return 0;
+  }
+  return size <= buffer_length - *offset ? size : buffer_length - *offset;
+}
+
+
+static bool buffer_get_no_assert(const jerry_value_t jargv[],
+                                 const jerry_length_t jargc,
+                                 jerry_length_t index) {
+  return jargc > index && jerry_value_is_boolean(jargv[index]) &&
+         jerry_get_boolean_value(jargv[index]);
+}
+
+
+// Without `noAssert` the value must fit into the buffer. Otherwise the bytes
+// outside of the buffer are read as zeros and are never written.
+static jerry_value_t buffer_read_number(const jerry_value_t jargv[],
+                                        const jerry_length_t jargc, size_t size,
+                                        bool little_endian,
+                                        buffer_number_type_t type) {
+  DJS_CHECK_ARGS(2, object, number);
+  JS_DECLARE_OBJECT_PTR(0, bufferwrap, buffer_wrap);
+
+  size_t offset;
+  size_t nbytes = buffer_get_number_bytes(buffer_wrap, jargv[1], size, &offset);
+  if (nbytes < size && !buffer_get_no_assert(jargv, jargc, 2)) {
+    return JS_CREATE_ERROR(RANGE, "index out of range");
+  }
+
+  uint8_t bytes[8] = { 0 };
+  if (nbytes > 0) {
+    memcpy(bytes, buffer_wrap->buffer + offset, nbytes);
+  }
+
+  uint64_t bits = buffer_load_bytes(bytes, size, little_endian);
+  double value;
+
+  if (type == BUFFER_NUMBER_FLOAT) {
+    if (size == sizeof(float)) {
+      uint32_t bits32 = (uint32_t)bits;
+      float value32;
+      memcpy(&value32, &bits32, sizeof(float));
+      value = value32;
+    } else {
+      memcpy(&value, &bits, sizeof(double));
+    }
+  } else if (type == BUFFER_NUMBER_INT && (bits >> (size * 8 - 1)) != 0) {
+    value = (double)bits - (double)((uint64_t)1 << (size * 8));
+  } else {
+    value = (double)bits;
+  }
+
+  return jerry_create_number(value);
+}
+
+
+static jerry_value_t buffer_write_number(const jerry_value_t jargv[],
+                                         const jerry_length_t jargc,
+                                         size_t size, bool little_endian,
+                                         buffer_number_type_t type) {
+  DJS_CHECK_ARGS(3, object, number, number);
+  JS_DECLARE_OBJECT_PTR(0, bufferwrap, buffer_wrap);
+
+  size_t offset;
+  size_t nbytes = buffer_get_number_bytes(buffer_wrap, jargv[2], size, &offset);
+  if (nbytes < size && !buffer_get_no_assert(jargv, jargc, 3)) {
+    return JS_CREATE_ERROR(RANGE, "index out of range");
+  }
+
+  double value = JS_GET_ARG(1, number);
+  uint64_t bits;
+
+  if (type == BUFFER_NUMBER_FLOAT) {
+    if (size == sizeof(float)) {
+      float value32 = (float)value;
+      uint32_t bits32;
+      memcpy(&bits32, &value32, sizeof(float));
+      bits = bits32;
+    } else {
+      memcpy(&bits, &value, sizeof(double));
+    }
+  } else {
+    bits = buffer_number_to_uint32(value);
+  }
+
+  uint8_t bytes[8];
+  buffer_store_bytes(bytes, bits, size, little_endian);
+  if (nbytes > 0) {
+    memcpy(buffer_wrap->buffer + offset, bytes, nbytes);
+  }
+
+  return jerry_create_number((double)offset + size);
+}
+
+
+#define BUFFER_NUMBER_ACCESSORS(name, size, little_endian, type)         \
+  JS_FUNCTION(buffer_read_##name) {                                      \
+    return buffer_read_number(jargv, jargc, size, little_endian, type);  \
+  }                                                                      \
+  JS_FUNCTION(buffer_write_##name) {                                     \
+    return buffer_write_number(jargv, jargc, size, little_endian, type); \
+  }
+
+BUFFER_NUMBER_ACCESSORS(uint16le, 2, true, BUFFER_NUMBER_UINT)
+BUFFER_NUMBER_ACCESSORS(uint16be, 2, false, BUFFER_NUMBER_UINT)
+BUFFER_NUMBER_ACCESSORS(uint32le, 4, true, BUFFER_NUMBER_UINT)
+BUFFER_NUMBER_ACCESSORS(uint32be, 4, false, BUFFER_NUMBER_UINT)
+BUFFER_NUMBER_ACCESSORS(int16le, 2, true, BUFFER_NUMBER_INT)
+BUFFER_NUMBER_ACCESSORS(int16be, 2, false, BUFFER_NUMBER_INT)
+BUFFER_NUMBER_ACCESSORS(int32le, 4, true, BUFFER_NUMBER_INT)
+BUFFER_NUMBER_ACCESSORS(int32be, 4, false, BUFFER_NUMBER_INT)
+BUFFER_NUMBER_ACCESSORS(floatle, 4, true, BUFFER_NUMBER_FLOAT)
+BUFFER_NUMBER_ACCESSORS(floatbe, 4, false, BUFFER_NUMBER_FLOAT)
+BUFFER_NUMBER_ACCESSORS(doublele, 8, true, BUFFER_NUMBER_FLOAT)
+BUFFER_NUMBER_ACCESSORS(doublebe, 8, false, BUFFER_NUMBER_FLOAT)
+
+#undef BUFFER_NUMBER_ACCESSORS
+
+
+static void buffer_fill_pattern(char* dst, size_t size, const char* pattern,
+                                size_t pattern_length) {
+  if (pattern_length > size) {
+    pattern_length = size;
+  }
+
+  // The pattern may be part of the destination buffer.
+  memmove(dst, pattern, pattern_length);
+
+  // Double the already filled region until the whole range is covered.
+  size_t filled = pattern_length;
+  while (filled < size) {
+    size_t chunk = filled <= size - filled ? filled : size - filled;
+    memcpy(dst + filled, dst, chunk);
+    filled += chunk;
+  }
+}
+
+
+JS_FUNCTION(buffer_fill) {
+  DJS_CHECK_ARGS(4, object, any, number, number);
+  JS_DECLARE_OBJECT_PTR(0, bufferwrap, buffer_wrap);
+
+  size_t buffer_length = iotjs_bufferwrap_length(buffer_wrap);
+
+  size_t start = iotjs_convert_double_to_sizet(JS_GET_ARG(2, number));
+  start = bound_range(start, 0, buffer_length);
+
+  size_t end = iotjs_convert_double_to_sizet(JS_GET_ARG(3, number));
+  end = bound_range(end, 0, buffer_length);
+
+  if (end <= start) {
+    return jerry_create_undefined();
+  }
+
+  char* dst = buffer_wrap->buffer + start;
+  size_t size = end - start;
+
+  if (jerry_value_is_number(jargv[1])) {
+    uint32_t value = buffer_number_to_uint32(JS_GET_ARG(1, number));
+    memset(dst, (int)(value & 0xff), size);
+    return jerry_create_undefined();
+  }
+
+  iotjs_tmp_buffer_t pattern;
+  iotjs_jval_as_tmp_buffer(jargv[1], &pattern);
+
+  if (jerry_value_is_error(pattern.jval)) {
+    return pattern.jval;
+  }
+
+  if (pattern.length == 0) {
+    memset(dst, 0, size);
+  } else if (pattern.length == 1) {
+    memset(dst, pattern.buffer[0], size);
+  } else {
+    buffer_fill_pattern(dst, size, pattern.buffer, pattern.length);
+  }
+
+  iotjs_free_tmp_buffer(&pattern);
+  return jerry_create_undefined();
+}
+
+
+// Horspool shift tables store at most this distance so they fit in bytes.
+// Smaller shifts than possible are still correct, only slower.
+#define BUFFER_SEARCH_MAX_SHIFT 255
+
+static size_t buffer_search_shift(size_t distance) {
+  return distance < BUFFER_SEARCH_MAX_SHIFT ? distance
+                                            : BUFFER_SEARCH_MAX_SHIFT;
+}
+
+
+// Returns the index of the first occurrence of `needle` at or after
+// `start`, or SIZE_MAX if there is none.
+static size_t buffer_search_forward(const uint8_t* data, size_t length,
+                                    const uint8_t* needle, size_t needle_length,
+                                    size_t start) {
+  if (needle_length > length || start > length - needle_length) {
+    return SIZE_MAX;
+  }
+
+  if (needle_length == 1) {
+    const uint8_t* found = memchr(data + start, needle[0], length - start);
+    return found != NULL ? (size_t)(found - data) : SIZE_MAX;
+  }
+
+  uint8_t shift[256];
+  size_t last = needle_length - 1;
+
+  memset(shift, (int)buffer_search_shift(needle_length), sizeof(shift));
+  for (size_t i = 0; i < last; i++) {
+    shift[needle[i]] = (uint8_t)buffer_search_shift(last - i);
+  }
+
+  for (size_t pos = start; pos <= length - needle_length;) {
+    uint8_t c = data[pos + last];
+
+    if (c == needle[last] && memcmp(data + pos, needle, last) == 0) {
+      return pos;
+    }
+    pos += shift[c];
+  }
+
+  return SIZE_MAX;
+}
+
+
+// Returns the index of the last occurrence of `needle` starting at or
+// before `start`, or SIZE_MAX if there is none.
+static size_t buffer_search_backward(const uint8_t* data, size_t length,
+                                     const uint8_t* needle,
+                                     size_t needle_length, size_t start) {
+  if (needle_length > length) {
+    return SIZE_MAX;
+  }
+
+  size_t pos = length - needle_length;
+  if (start < pos) {
+    pos = start;
+  }
+
+  if (needle_length == 1) {
+    for (const uint8_t* p = data + pos + 1; p > data;) {
+      if (*--p == needle[0]) {
+        return (size_t)(p - data);
+      }
+    }
+    return SIZE_MAX;
+  }
+
+  uint8_t shift[256];
+
+  memset(shift, (int)buffer_search_shift(needle_length), sizeof(shift));
+  for (size_t i = needle_length - 1; i > 0; i--) {
+    shift[needle[i]] = (uint8_t)buffer_search_shift(i);
+  }
+
+  while (true) {
+    uint8_t c = data[pos];
+
+    if (c == needle[0] &&
+        memcmp(data + pos + 1, needle + 1, needle_length - 1) == 0) {
+      return pos;
+    }
+    if (pos < shift[c]) {
+      return SIZE_MAX;
+    }
+    pos -= shift[c];
+  }
+}
+
+
+static size_t buffer_search(const uint8_t* data, size_t length,
+                            const uint8_t* needle, size_t needle_length,
+                            size_t start, bool last) {
+  // An empty needle matches at the start position.
+  if (needle_length == 0) {
+    return start;
+  }
+
+  if (last) {
+    return buffer_search_backward(data, length, needle, needle_length, start);
+  }
+  return buffer_search_forward(data, length, needle, needle_length, start);
+}
+
+
+JS_FUNCTION(buffer_index_of) {
+  DJS_CHECK_ARGS(4, object, any, number, boolean);
+  JS_DECLARE_OBJECT_PTR(0, bufferwrap, buffer_wrap);
+
+  double offset = JS_GET_ARG(2, number);
+  bool last = JS_GET_ARG(3, boolean);
+
+  const uint8_t* data = (const uint8_t*)buffer_wrap->buffer;
+  size_t length = buffer_wrap->length;
+  size_t start = length;
+
+  if (offset < 0) {
+    if (last) {
+      return jerry_create_number(-1);
+    }
+    start = 0;
+  } else if (offset < (double)length) {
+    start = (size_t)offset;
+  }
+
+  size_t index;
+
+  if (jerry_value_is_number(jargv[1])) {
+    uint8_t byte = (uint8_t)buffer_number_to_uint32(JS_GET_ARG(1, number));
+    index = buffer_search(data, length, &byte, 1, start, last);
+  } else {
+    iotjs_tmp_buffer_t needle;
+    iotjs_jval_as_tmp_buffer(jargv[1], &needle);
+
+    if (jerry_value_is_error(needle.jval)) {
+      return needle.jval;
+    }
+
+    index = buffer_search(data, length, (const uint8_t*)needle.buffer,
+                          needle.length, start, last);
+    iotjs_free_tmp_buffer(&needle);
+  }
+
+  return jerry_create_number(index == SIZE_MAX ? -1 : (double)index);
+}
+
+
 JS_FUNCTION(buffer_slice) {
   DJS_CHECK_ARGS(3, object, number, number);
   JS_DECLARE_OBJECT_PTR(0, bufferwrap, buffer_wrap);
@@ -537,13 +1768,7 @@ JS_FUNCTION(buffer_slice) {
 
   size_t length = (size_t)(end_idx - start_idx);
 
-  jerry_value_t jnew_buffer = iotjs_bufferwrap_create_buffer(length);
-  iotjs_bufferwrap_t* new_buffer_wrap =
-      iotjs_bufferwrap_from_jbuffer(jnew_buffer);
-  iotjs_bufferwrap_copy_internal(new_buffer_wrap, buffer_wrap->buffer,
-                                 start_idx, end_idx, 0);
-
-  return jnew_buffer;
+  return iotjs_bufferwrap_create_buffer_slice(buffer_wrap, start_idx, length);
 }
 
 
@@ -552,25 +1777,29 @@ static char to_hex_char(uint8_t digit) {
 }
 
 
+static void hex_encode(char* dst, const uint8_t* src, size_t length) {
+  size_t i = hex_encode_simd(dst, src, length);
+
+  for (; i < length; i++) {
+    dst[2 * i] = to_hex_char(src[i] >> 4);
+    dst[2 * i + 1] = to_hex_char(src[i] & 0xf);
+  }
+}
+
+
 static jerry_value_t to_hex_string(const uint8_t* data, size_t length) {
   if (length == 0) {
     return jerry_create_string_sz(NULL, 0);
   }
 
-  const uint8_t* end = data + length;
-
   size_t buffer_length = length * 2;
-  char* buffer = iotjs_buffer_allocate(buffer_length);
-  const jerry_char_t* str = (const jerry_char_t*)buffer;
+  char* buffer = iotjs_buffer_allocate_uninitialized(buffer_length);
 
-  while (data < end) {
-    *buffer++ = to_hex_char(*data >> 4);
-    *buffer++ = to_hex_char(*data & 0xf);
-    data++;
-  }
+  hex_encode(buffer, data, length);
 
-  jerry_value_t ret_value = jerry_create_string_sz(str, buffer_length);
-  IOTJS_RELEASE(str);
+  jerry_value_t ret_value =
+      jerry_create_string_sz((const jerry_char_t*)buffer, buffer_length);
+  IOTJS_RELEASE(buffer);
 
   return ret_value;
 }
@@ -585,14 +1814,11 @@ static jerry_value_t to_base64_string(const uint8_t* data, size_t length) {
   return ret_value;
 }
 
-static const unsigned char base64_enc_map[65] =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
 
 size_t iotjs_base64_encode(unsigned char** out_buff, const unsigned char* data,
                            size_t buff_len) {
   size_t i, n;
-  int C1, C2, C3;
+  int C1, C2;
   unsigned char* p;
 
   if (buff_len == 0) {
@@ -609,19 +1835,23 @@ size_t iotjs_base64_encode(unsigned char** out_buff, const unsigned char* data,
     *out_buff = IOTJS_CALLOC(n * 4 + 1, unsigned char);
   }
 
-  n = (buff_len / 3) * 3;
+  n = buff_len / 3;
+  p = *out_buff;
 
-  for (i = 0, p = *out_buff; i < n; i += 3) {
-    C1 = *data++;
-    C2 = *data++;
-    C3 = *data++;
+  for (i = base64_encode_simd(p, data, n); i < n; i++) {
+    const unsigned char* in = data + 3 * i;
+    uint32_t bits = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
 
-    *p++ = base64_enc_map[(C1 >> 2) & 0x3F];
-    *p++ = base64_enc_map[(((C1 & 3) << 4) + (C2 >> 4)) & 0x3F];
-    *p++ = base64_enc_map[(((C2 & 15) << 2) + (C3 >> 6)) & 0x3F];
-    *p++ = base64_enc_map[C3 & 0x3F];
+    p[4 * i] = base64_enc_map[bits >> 18];
+    p[4 * i + 1] = base64_enc_map[(bits >> 12) & 0x3F];
+    p[4 * i + 2] = base64_enc_map[(bits >> 6) & 0x3F];
+    p[4 * i + 3] = base64_enc_map[bits & 0x3F];
   }
 
+  p += 4 * n;
+  data += 3 * n;
+  i = 3 * n;
+
   if (i < buff_len) {
     C1 = *data++;
     C2 = ((i + 1) < buff_len) ? *data++ : 0;
@@ -751,7 +1981,8 @@ JS_FUNCTION(buffer_from_array_buffer) {
     return iotjs_bufferwrap_create_buffer(0);
   }
 
-  jerry_value_t jres_bufferwrap = iotjs_bufferwrap_create_buffer(length);
+  jerry_value_t jres_bufferwrap =
+      iotjs_bufferwrap_create_buffer_uninitialized(length);
   iotjs_bufferwrap_t* jsres_buffer =
       iotjs_jbuffer_get_bufferwrap_ptr(jres_bufferwrap);
   jerry_arraybuffer_read(jargv[0], offset, (uint8_t*)jsres_buffer->buffer,
@@ -765,7 +1996,10 @@ jerry_value_t iotjs_init_buffer(void) {
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_BYTELENGTH,
                         buffer_byte_length);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_COMPARE, buffer_compare);
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_CONCAT, buffer_concat);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_COPY, buffer_copy);
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_FILL, buffer_fill);
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_INDEXOF, buffer_index_of);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_WRITE, buffer_write);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_WRITEDECODE,
                         buffer_write_decode);
@@ -773,10 +2007,35 @@ jerry_value_t iotjs_init_buffer(void) {
                         buffer_write_uint8);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_READUINT8,
                         buffer_read_uint8);
+
+#define BUFFER_SET_NUMBER_ACCESSORS(NAME, name)                 \
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_READ##NAME,  \
+                        buffer_read_##name);                    \
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_WRITE##NAME, \
+                        buffer_write_##name);
+
+  BUFFER_SET_NUMBER_ACCESSORS(UINT16LE, uint16le)
+  BUFFER_SET_NUMBER_ACCESSORS(UINT16BE, uint16be)
+  BUFFER_SET_NUMBER_ACCESSORS(UINT32LE, uint32le)
+  BUFFER_SET_NUMBER_ACCESSORS(UINT32BE, uint32be)
+  BUFFER_SET_NUMBER_ACCESSORS(INT16LE, int16le)
+  BUFFER_SET_NUMBER_ACCESSORS(INT16BE, int16be)
+  BUFFER_SET_NUMBER_ACCESSORS(INT32LE, int32le)
+  BUFFER_SET_NUMBER_ACCESSORS(INT32BE, int32be)
+  BUFFER_SET_NUMBER_ACCESSORS(FLOATLE, floatle)
+  BUFFER_SET_NUMBER_ACCESSORS(FLOATBE, floatbe)
+  BUFFER_SET_NUMBER_ACCESSORS(DOUBLELE, doublele)
+  BUFFER_SET_NUMBER_ACCESSORS(DOUBLEBE, doublebe)
+
+#undef BUFFER_SET_NUMBER_ACCESSORS
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_SLICE, buffer_slice);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_TOSTRING, buffer_to_string);
   iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_FROM_ARRAYBUFFER,
                         buffer_from_array_buffer);
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_ALLOCUNSAFE,
+                        buffer_alloc_unsafe);
+  iotjs_jval_set_method(buffer, IOTJS_MAGIC_STRING_POOLSTATS,
+                        buffer_pool_stats);
 
   return buffer;
 }
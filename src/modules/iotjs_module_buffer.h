@@ -22,12 +22,20 @@ typedef struct {
   void* free_info;
 } iotjs_bufferwrap_external_info_t;
 
-typedef struct {
+typedef struct iotjs_bufferwrap_t iotjs_bufferwrap_t;
+
+struct iotjs_bufferwrap_t {
   jerry_value_t jobject;
   size_t length;
+  // Start of the bytes of this buffer. Points into `storage` of either this
+  // wrap or, for slices, of the `parent` wrap owning the memory.
+  char* buffer;
+  iotjs_bufferwrap_t* parent;
+  // Number of references to `storage`: the owning object plus its slices.
+  uint32_t refcount;
   iotjs_bufferwrap_external_info_t* external_info;
-  char buffer[];
-} iotjs_bufferwrap_t;
+  char storage[];
+};
 
 size_t iotjs_base64_decode(char** out_buff, const char* src,
                            const size_t srcLen);
@@ -35,6 +43,9 @@ size_t iotjs_base64_encode(unsigned char** out_buff, const uint8_t* data,
                            size_t length);
 iotjs_bufferwrap_t* iotjs_bufferwrap_create(const jerry_value_t jbuiltin,
                                             size_t length);
+iotjs_bufferwrap_t* iotjs_bufferwrap_create_slice(const jerry_value_t jobject,
+                                                  iotjs_bufferwrap_t* source,
+                                                  size_t offset, size_t length);
 
 void iotjs_bufferwrap_set_external_callback(iotjs_bufferwrap_t* bufferwrap,
                                             void* free_hint, void* free_info);
@@ -53,6 +64,32 @@ iotjs_bufferwrap_t* iotjs_jbuffer_get_bufferwrap_ptr(const jerry_value_t);
 
 // Fail-safe creation of Buffer object.
 jerry_value_t iotjs_bufferwrap_create_buffer(size_t len);
+// Same as above, but the content is not zero filled. The caller must
+// overwrite all of the bytes.
+jerry_value_t iotjs_bufferwrap_create_buffer_uninitialized(size_t len);
+// Creates a Buffer object holding the UTF-8 bytes of `jstring`. The string
+// is encoded directly into the storage of the buffer.
+jerry_value_t iotjs_bufferwrap_create_buffer_from_string(
+    const jerry_value_t jstring);
+// Creates a Buffer object sharing the memory of `source`.
+jerry_value_t iotjs_bufferwrap_create_buffer_slice(iotjs_bufferwrap_t* source,
+                                                   size_t offset, size_t len);
+
+// Returns `size` bytes of the shared read slab to receive data into. The
+// received bytes must be claimed by iotjs_bufferwrap_slab_create_buffer
+// before the slab is used again.
+char* iotjs_bufferwrap_slab_allocate(size_t size);
+// Creates a Buffer object for `len` bytes received into the memory returned
+// by the last iotjs_bufferwrap_slab_allocate call. The data is not copied.
+jerry_value_t iotjs_bufferwrap_slab_create_buffer(const char* data,
+                                                  size_t len);
+
+// Releases the cached Buffer prototype, must be called before the engine
+// is cleaned up.
+void iotjs_bufferwrap_prototype_cleanup(void);
+
+// Releases the cached storage of freed buffers.
+void iotjs_bufferwrap_pool_cleanup(void);
 
 
 #endif /* IOTJS_MODULE_BUFFER_H */
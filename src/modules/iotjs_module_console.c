@@ -16,30 +16,253 @@
 #include "iotjs_def.h"
 #include "iotjs_debuglog.h"
 
+#include "iotjs_module_console.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifndef IOTJS_CONSOLE_QUEUE_SIZE
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_CONSOLE_QUEUE_SIZE 2048
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_CONSOLE_QUEUE_SIZE (16 * 1024)
+#endif /* __NUTTX__ || __TIZENRT__ */
+#endif /* IOTJS_CONSOLE_QUEUE_SIZE */
+
+#ifndef IOTJS_CONSOLE_MAX_QUEUE_SIZE
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_CONSOLE_MAX_QUEUE_SIZE (64 * 1024)
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_CONSOLE_MAX_QUEUE_SIZE (4 * 1024 * 1024)
+#endif /* __NUTTX__ || __TIZENRT__ */
+#endif /* IOTJS_CONSOLE_MAX_QUEUE_SIZE */
+
+
+/**
+ * In asynchronous mode the output of each stream is copied into a ring
+ * buffer and written out by a separate thread, so slow consoles do not
+ * stall the event loop. When a message does not fit into the queue it is
+ * either dropped or the caller waits until the writer makes room.
+ */
+typedef struct {
+  FILE* out_fd;
+  char* data;
+  size_t capacity;
+  // Offset of the first queued byte.
+  size_t start;
+  // Number of queued bytes, including the ones being written.
+  size_t length;
+  uint32_t dropped;
+} iotjs_console_queue_t;
+
+typedef struct {
+  // The queues of stdout and stderr.
+  iotjs_console_queue_t queues[2];
+  bool enabled;
+  bool block;
+  bool stopping;
+  uv_thread_t thread;
+  uv_mutex_t mutex;
+  uv_cond_t has_data;
+  uv_cond_t has_space;
+} iotjs_console_async_t;
+
+static iotjs_console_async_t console_async;
+
+
+// Writes `str` in as few stdio calls as possible. Every NUL character is
+// replaced by its escape sequence.
+static void console_write(FILE* out_fd, const char* str, size_t len) {
+  const char* end = str + len;
+
+  while (str < end) {
+    const char* nul = memchr(str, '\0', (size_t)(end - str));
+    const char* span_end = (nul != NULL) ? nul : end;
+
+    if (span_end > str) {
+      fwrite(str, 1, (size_t)(span_end - str), out_fd);
+    }
+    if (nul == NULL) {
+      break;
+    }
+
+    fputs("\\u0000", out_fd);
+    str = nul + 1;
+  }
+}
+
+
+static void console_writer(void* arg) {
+  uv_mutex_lock(&console_async.mutex);
+
+  for (;;) {
+    iotjs_console_queue_t* queue = NULL;
+
+    for (int i = 0; i < 2; i++) {
+      if (console_async.queues[i].length > 0) {
+        queue = &console_async.queues[i];
+        break;
+      }
+    }
+
+    if (queue == NULL) {
+      if (console_async.stopping) {
+        break;
+      }
+      uv_cond_wait(&console_async.has_data, &console_async.mutex);
+      continue;
+    }
+
+    // The bytes stay queued until they are written, so the event loop
+    // does not overwrite them meanwhile.
+    size_t size = queue->capacity - queue->start;
+    if (size > queue->length) {
+      size = queue->length;
+    }
+
+    uv_mutex_unlock(&console_async.mutex);
+    console_write(queue->out_fd, queue->data + queue->start, size);
+    fflush(queue->out_fd);
+    uv_mutex_lock(&console_async.mutex);
+
+    queue->start = (queue->start + size) % queue->capacity;
+    queue->length -= size;
+    uv_cond_signal(&console_async.has_space);
+  }
+
+  uv_mutex_unlock(&console_async.mutex);
+}
+
+
+static void console_queue_push(iotjs_console_queue_t* queue, const char* str,
+                               size_t len) {
+  size_t end = (queue->start + queue->length) % queue->capacity;
+  size_t first = queue->capacity - end;
+  if (first > len) {
+    first = len;
+  }
+
+  memcpy(queue->data + end, str, first);
+  memcpy(queue->data, str + first, len - first);
+  queue->length += len;
+}
+
+
+static void console_print_async(iotjs_console_queue_t* queue, const char* str,
+                                size_t len) {
+  uv_mutex_lock(&console_async.mutex);
+
+  if (len > queue->capacity - queue->length) {
+    if (!console_async.block) {
+      queue->dropped++;
+      uv_mutex_unlock(&console_async.mutex);
+      return;
+    }
+
+    // Messages larger than the whole queue are written directly once the
+    // queued output is out.
+    size_t needed = (len < queue->capacity) ? len : queue->capacity;
+    while (queue->capacity - queue->length < needed) {
+      uv_cond_wait(&console_async.has_space, &console_async.mutex);
+    }
+
+    if (len > queue->capacity) {
+      console_write(queue->out_fd, str, len);
+      uv_mutex_unlock(&console_async.mutex);
+      return;
+    }
+  }
+
+  console_queue_push(queue, str, len);
+  uv_cond_signal(&console_async.has_data);
+
+  uv_mutex_unlock(&console_async.mutex);
+}
+
+
+static void console_async_stop(void) {
+  if (!console_async.enabled) {
+    return;
+  }
+
+  uv_mutex_lock(&console_async.mutex);
+  console_async.stopping = true;
+  uv_cond_signal(&console_async.has_data);
+  uv_mutex_unlock(&console_async.mutex);
+
+  uv_thread_join(&console_async.thread);
+
+  uv_cond_destroy(&console_async.has_space);
+  uv_cond_destroy(&console_async.has_data);
+  uv_mutex_destroy(&console_async.mutex);
+
+  for (int i = 0; i < 2; i++) {
+    IOTJS_RELEASE(console_async.queues[i].data);
+  }
+
+  console_async.enabled = false;
+}
+
+
+static bool console_async_start(size_t queue_size, bool block) {
+  memset(&console_async, 0, sizeof(iotjs_console_async_t));
+
+  console_async.block = block;
+  console_async.queues[0].out_fd = stdout;
+  console_async.queues[1].out_fd = stderr;
+
+  // The queues may be large, so running out of memory is reported to the
+  // caller instead of terminating the process.
+  for (int i = 0; i < 2; i++) {
+    console_async.queues[i].data = (char*)malloc(queue_size);
+    console_async.queues[i].capacity = queue_size;
+
+    if (console_async.queues[i].data == NULL) {
+      IOTJS_RELEASE(console_async.queues[0].data);
+      return false;
+    }
+  }
+
+  uv_mutex_init(&console_async.mutex);
+  uv_cond_init(&console_async.has_data);
+  uv_cond_init(&console_async.has_space);
+
+  if (uv_thread_create(&console_async.thread, console_writer, NULL) != 0) {
+    uv_cond_destroy(&console_async.has_space);
+    uv_cond_destroy(&console_async.has_data);
+    uv_mutex_destroy(&console_async.mutex);
+
+    for (int i = 0; i < 2; i++) {
+      IOTJS_RELEASE(console_async.queues[i].data);
+    }
+    return false;
+  }
+
+  console_async.enabled = true;
+  return true;
+}
+
+
 // This function should be able to print utf8 encoded string
 // as utf8 is internal string representation in Jerryscript
 static jerry_value_t console_print(const jerry_value_t* jargv,
                                    const jerry_length_t jargc, FILE* out_fd) {
   DJS_CHECK_ARGS(1, string);
-  iotjs_string_t msg = JS_GET_ARG(0, string);
-  const char* str = iotjs_string_data(&msg);
-  unsigned str_len = iotjs_string_size(&msg);
-  unsigned idx = 0;
+  iotjs_stack_string_t msg;
+  iotjs_jval_as_stack_string(jargv[0], &msg);
 
   if (iotjs_console_out) {
     int level = (out_fd == stdout) ? DBGLEV_INFO : DBGLEV_ERR;
-    iotjs_console_out(level, "%s", str);
+    iotjs_console_out(level, "%s", msg.data);
+  } else if (console_async.enabled) {
+    int index = (out_fd == stdout) ? 0 : 1;
+    console_print_async(&console_async.queues[index], msg.data, msg.size);
   } else {
-    for (idx = 0; idx < str_len; idx++) {
-      if (str[idx] != 0) {
-        fprintf(out_fd, "%c", str[idx]);
-      } else {
-        fprintf(out_fd, "\\u0000");
-      }
-    }
+    console_write(out_fd, msg.data, msg.size);
   }
 
-  iotjs_string_destroy(&msg);
+  iotjs_free_stack_string(&msg);
   return jerry_create_undefined();
 }
 
@@ -54,11 +277,75 @@ JS_FUNCTION(console_stderr) {
 }
 
 
+// Switches between synchronous and asynchronous output. The queued output
+// is written out before the mode changes.
+// [0] enable
+// [1] queue size of each stream in bytes, 0 for the default size
+// [2] `true` to wait for room instead of dropping messages
+// The asynchronous mode is refused when the output is redirected by
+// `iotjs_console_out`, since that output never goes through the queues.
+JS_FUNCTION(console_set_async) {
+  DJS_CHECK_ARGS(3, boolean, number, boolean);
+
+  console_async_stop();
+
+  if (!JS_GET_ARG(0, boolean)) {
+    return jerry_create_boolean(true);
+  }
+
+  double size = JS_GET_ARG(1, number);
+  if (iotjs_console_out || !(size >= 0) ||
+      size > IOTJS_CONSOLE_MAX_QUEUE_SIZE) {
+    return jerry_create_boolean(false);
+  }
+
+  size_t queue_size = (size >= 1) ? (size_t)size : IOTJS_CONSOLE_QUEUE_SIZE;
+
+  return jerry_create_boolean(
+      console_async_start(queue_size, JS_GET_ARG(2, boolean)));
+}
+
+
+JS_FUNCTION(console_async_stats) {
+  uint32_t queued = 0;
+  uint32_t dropped = 0;
+
+  if (console_async.enabled) {
+    uv_mutex_lock(&console_async.mutex);
+    for (int i = 0; i < 2; i++) {
+      queued += (uint32_t)console_async.queues[i].length;
+      dropped += console_async.queues[i].dropped;
+    }
+    uv_mutex_unlock(&console_async.mutex);
+  }
+
+  jerry_value_t jstats = jerry_create_object();
+  iotjs_jval_set_property_boolean(jstats, IOTJS_MAGIC_STRING_ENABLED,
+                                  console_async.enabled);
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_QUEUEDBYTES,
+                                 queued);
+  iotjs_jval_set_property_number(jstats, IOTJS_MAGIC_STRING_DROPPEDMESSAGES,
+                                 dropped);
+  return jstats;
+}
+
+
+void iotjs_console_cleanup(void) {
+  console_async_stop();
+}
+
+
 jerry_value_t iotjs_init_console(void) {
   jerry_value_t console = jerry_create_object();
 
   iotjs_jval_set_method(console, IOTJS_MAGIC_STRING_STDOUT, console_stdout);
   iotjs_jval_set_method(console, IOTJS_MAGIC_STRING_STDERR, console_stderr);
+  iotjs_jval_set_method(console, IOTJS_MAGIC_STRING_SETASYNC,
+                        console_set_async);
+  iotjs_jval_set_method(console, IOTJS_MAGIC_STRING_ASYNCSTATS,
+                        console_async_stats);
+  iotjs_jval_set_property_number(console, IOTJS_MAGIC_STRING_MAX_QUEUE_SIZE_U,
+                                 IOTJS_CONSOLE_MAX_QUEUE_SIZE);
 
   return console;
 }
@@ -185,19 +185,20 @@ JS_FUNCTION(fs_open) {
 
   const iotjs_environment_t* env = iotjs_environment_get();
 
-  iotjs_string_t path = JS_GET_ARG(0, string);
+  iotjs_stack_string_t path;
+  iotjs_jval_as_stack_string(jargv[0], &path);
   int flags = JS_GET_ARG(1, number);
   int mode = JS_GET_ARG(2, number);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(3, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, open, jcallback, iotjs_string_data(&path), flags, mode);
+    FS_ASYNC(env, open, jcallback, path.data, flags, mode);
   } else {
-    FS_SYNC(env, open, iotjs_string_data(&path), flags, mode);
+    FS_SYNC(env, open, path.data, flags, mode);
   }
 
-  iotjs_string_destroy(&path);
+  iotjs_free_stack_string(&path);
   return ret_value;
 }
 
@@ -301,17 +302,18 @@ JS_FUNCTION(fs_stat) {
 
   const iotjs_environment_t* env = iotjs_environment_get();
 
-  iotjs_string_t path = JS_GET_ARG(0, string);
+  iotjs_stack_string_t path;
+  iotjs_jval_as_stack_string(jargv[0], &path);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(1, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, stat, jcallback, iotjs_string_data(&path));
+    FS_ASYNC(env, stat, jcallback, path.data);
   } else {
-    FS_SYNC(env, stat, iotjs_string_data(&path));
+    FS_SYNC(env, stat, path.data);
   }
 
-  iotjs_string_destroy(&path);
+  iotjs_free_stack_string(&path);
   return ret_value;
 }
 
@@ -343,18 +345,19 @@ JS_FUNCTION(fs_mkdir) {
 
   const iotjs_environment_t* env = iotjs_environment_get();
 
-  iotjs_string_t path = JS_GET_ARG(0, string);
+  iotjs_stack_string_t path;
+  iotjs_jval_as_stack_string(jargv[0], &path);
   int mode = JS_GET_ARG(1, number);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(2, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, mkdir, jcallback, iotjs_string_data(&path), mode);
+    FS_ASYNC(env, mkdir, jcallback, path.data, mode);
   } else {
-    FS_SYNC(env, mkdir, iotjs_string_data(&path), mode);
+    FS_SYNC(env, mkdir, path.data, mode);
   }
 
-  iotjs_string_destroy(&path);
+  iotjs_free_stack_string(&path);
   return ret_value;
 }
 
@@ -366,17 +369,18 @@ JS_FUNCTION(fs_rmdir) {
 
   const iotjs_environment_t* env = iotjs_environment_get();
 
-  iotjs_string_t path = JS_GET_ARG(0, string);
+  iotjs_stack_string_t path;
+  iotjs_jval_as_stack_string(jargv[0], &path);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(1, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, rmdir, jcallback, iotjs_string_data(&path));
+    FS_ASYNC(env, rmdir, jcallback, path.data);
   } else {
-    FS_SYNC(env, rmdir, iotjs_string_data(&path));
+    FS_SYNC(env, rmdir, path.data);
   }
 
-  iotjs_string_destroy(&path);
+  iotjs_free_stack_string(&path);
   return ret_value;
 }
 
@@ -388,17 +392,18 @@ JS_FUNCTION(fs_unlink) {
 
   const iotjs_environment_t* env = iotjs_environment_get();
 
-  iotjs_string_t path = JS_GET_ARG(0, string);
+  iotjs_stack_string_t path;
+  iotjs_jval_as_stack_string(jargv[0], &path);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(1, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, unlink, jcallback, iotjs_string_data(&path));
+    FS_ASYNC(env, unlink, jcallback, path.data);
   } else {
-    FS_SYNC(env, unlink, iotjs_string_data(&path));
+    FS_SYNC(env, unlink, path.data);
   }
 
-  iotjs_string_destroy(&path);
+  iotjs_free_stack_string(&path);
   return ret_value;
 }
 
@@ -410,21 +415,23 @@ JS_FUNCTION(fs_rename) {
 
   const iotjs_environment_t* env = iotjs_environment_get();
 
-  iotjs_string_t old_path = JS_GET_ARG(0, string);
-  iotjs_string_t new_path = JS_GET_ARG(1, string);
+  iotjs_stack_string_t old_path;
+  iotjs_jval_as_stack_string(jargv[0], &old_path);
+  iotjs_stack_string_t new_path;
+  iotjs_jval_as_stack_string(jargv[1], &new_path);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(2, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, rename, jcallback, iotjs_string_data(&old_path),
-             iotjs_string_data(&new_path));
+    FS_ASYNC(env, rename, jcallback, old_path.data,
+             new_path.data);
   } else {
-    FS_SYNC(env, rename, iotjs_string_data(&old_path),
-            iotjs_string_data(&new_path));
+    FS_SYNC(env, rename, old_path.data,
+            new_path.data);
   }
 
-  iotjs_string_destroy(&old_path);
-  iotjs_string_destroy(&new_path);
+  iotjs_free_stack_string(&old_path);
+  iotjs_free_stack_string(&new_path);
   return ret_value;
 }
 
@@ -435,16 +442,17 @@ JS_FUNCTION(fs_read_dir) {
   DJS_CHECK_ARG_IF_EXIST(1, function);
 
   const iotjs_environment_t* env = iotjs_environment_get();
-  iotjs_string_t path = JS_GET_ARG(0, string);
+  iotjs_stack_string_t path;
+  iotjs_jval_as_stack_string(jargv[0], &path);
   const jerry_value_t jcallback = JS_GET_ARG_IF_EXIST(1, function);
 
   jerry_value_t ret_value;
   if (!jerry_value_is_null(jcallback)) {
-    FS_ASYNC(env, scandir, jcallback, iotjs_string_data(&path), 0);
+    FS_ASYNC(env, scandir, jcallback, path.data, 0);
   } else {
-    FS_SYNC(env, scandir, iotjs_string_data(&path), 0);
+    FS_SYNC(env, scandir, path.data, 0);
   }
-  iotjs_string_destroy(&path);
+  iotjs_free_stack_string(&path);
   return ret_value;
 }
 
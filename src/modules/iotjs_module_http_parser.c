@@ -16,6 +16,8 @@
 
 #include "iotjs_def.h"
 #include "iotjs_module_buffer.h"
+#include "iotjs_module_http_parser.h"
+#include "iotjs_module_tcp.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -32,6 +34,34 @@
 // Increase this to minimize inter JS-C call
 #define HEADER_MAX 10
 
+// Number of wrappers of collected parsers kept for new parsers.
+#if defined(__NUTTX__) || defined(__TIZENRT__)
+#define IOTJS_HTTP_PARSER_POOL_SIZE 2
+#else /* !__NUTTX__ && !__TIZENRT__ */
+#define IOTJS_HTTP_PARSER_POOL_SIZE 8
+#endif /* __NUTTX__ || __TIZENRT__ */
+
+
+// Callbacks assigned from JS, cached by the property accessors of the
+// prototype so that parser events do not look them up by name.
+typedef enum {
+  kOnHeaders = 0,
+  kOnHeadersComplete,
+  kOnBody,
+  kOnMessageComplete,
+  kOnExecuteError,
+  kCallbackCount
+} iotjs_http_parser_callback_t;
+
+
+// Header name or value waiting to be passed to JS. Kept in plain heap
+// memory: the inline storage of iotjs_string_t would make every parser
+// over a kilobyte larger.
+typedef struct {
+  char* data;
+  size_t size;
+} iotjs_http_header_slot_t;
+
 
 typedef struct {
   jerry_value_t jobject;
@@ -41,8 +71,8 @@ typedef struct {
   iotjs_string_t url;
   iotjs_string_t status_msg;
 
-  iotjs_string_t fields[HEADER_MAX];
-  iotjs_string_t values[HEADER_MAX];
+  iotjs_http_header_slot_t fields[HEADER_MAX];
+  iotjs_http_header_slot_t values[HEADER_MAX];
   size_t n_fields;
   size_t n_values;
 
@@ -51,12 +81,119 @@ typedef struct {
   size_t cur_buf_len;
 
   bool flushed;
+  // Set while http_parser_execute runs, see iotjs_http_parserwrap_execute.
+  bool executing;
+
+  // With lazy headers the names and values are collected one after the
+  // other in `raw_headers`, `raw_offsets` has the start of each of them.
+  bool lazy_headers;
+  char* raw_headers;
+  size_t raw_size;
+  size_t raw_capacity;
+  uint32_t* raw_offsets;
+  size_t raw_offsets_length;
+  size_t raw_offsets_capacity;
+
+  // The TCP handle whose data is parsed as it is read, see consume().
+  uv_stream_t* stream;
+
+  jerry_value_t callbacks[kCallbackCount];
 } iotjs_http_parserwrap_t;
 
 
+typedef struct {
+  const char* name;
+  size_t size;
+} iotjs_http_header_name_t;
+
+#define HEADER_NAME(NAME) \
+  { NAME, sizeof(NAME) - 1 }
+
+// Header names sent by most clients and servers. Their JS strings are
+// created once, in this spelling and in lower case, and shared by all
+// parsed messages.
+static const iotjs_http_header_name_t common_header_names[] = {
+  HEADER_NAME("Accept"),
+  HEADER_NAME("Accept-Encoding"),
+  HEADER_NAME("Accept-Language"),
+  HEADER_NAME("Authorization"),
+  HEADER_NAME("Cache-Control"),
+  HEADER_NAME("Connection"),
+  HEADER_NAME("Content-Encoding"),
+  HEADER_NAME("Content-Length"),
+  HEADER_NAME("Content-Type"),
+  HEADER_NAME("Cookie"),
+  HEADER_NAME("Date"),
+  HEADER_NAME("ETag"),
+  HEADER_NAME("Host"),
+  HEADER_NAME("Keep-Alive"),
+  HEADER_NAME("Last-Modified"),
+  HEADER_NAME("Location"),
+  HEADER_NAME("Origin"),
+  HEADER_NAME("Server"),
+  HEADER_NAME("Set-Cookie"),
+  HEADER_NAME("Transfer-Encoding"),
+  HEADER_NAME("Upgrade"),
+  HEADER_NAME("User-Agent"),
+};
+
+#undef HEADER_NAME
+
+#define COMMON_HEADER_COUNT \
+  (sizeof(common_header_names) / sizeof(common_header_names[0]))
+
+// Interned names in both spellings, 0 until first used.
+static jerry_value_t common_header_jnames[COMMON_HEADER_COUNT][2];
+
+
 typedef enum http_parser_type http_parser_type;
 
 
+static void iotjs_http_header_slot_append(iotjs_http_header_slot_t* slot,
+                                          const char* at, size_t length) {
+  if (length == 0) {
+    return;
+  }
+
+  if (slot->data == NULL) {
+    slot->data = iotjs_buffer_allocate_uninitialized(length);
+  } else {
+    slot->data = iotjs_buffer_reallocate(slot->data, slot->size + length);
+  }
+
+  memcpy(slot->data + slot->size, at, length);
+  slot->size += length;
+}
+
+
+static void iotjs_http_header_slot_clear(iotjs_http_header_slot_t* slot) {
+  IOTJS_RELEASE(slot->data);
+  slot->size = 0;
+}
+
+
+static jerry_value_t iotjs_http_header_slot_to_jstring(
+    const iotjs_http_header_slot_t* slot) {
+  const jerry_char_t* data = (const jerry_char_t*)slot->data;
+
+  if (slot->size == 0) {
+    return jerry_create_string((const jerry_char_t*)"");
+  }
+
+  if (!jerry_is_valid_utf8_string(data, (jerry_size_t)slot->size)) {
+    return JS_CREATE_ERROR(TYPE, "Invalid UTF-8 string");
+  }
+
+  return jerry_create_string_sz_from_utf8(data, (jerry_size_t)slot->size);
+}
+
+
+// Wrappers of collected parsers. Their strings are empty and their
+// callbacks are undefined.
+static iotjs_http_parserwrap_t* parserwrap_pool[IOTJS_HTTP_PARSER_POOL_SIZE];
+static size_t parserwrap_pool_length = 0;
+
+
 static void iotjs_http_parserwrap_initialize(
     iotjs_http_parserwrap_t* http_parserwrap, http_parser_type type) {
   http_parser_init(&http_parserwrap->parser, type);
@@ -68,6 +205,8 @@ static void iotjs_http_parserwrap_initialize(
   http_parserwrap->cur_jbuf = jerry_create_null();
   http_parserwrap->cur_buf = NULL;
   http_parserwrap->cur_buf_len = 0;
+  http_parserwrap->raw_size = 0;
+  http_parserwrap->raw_offsets_length = 0;
 }
 
 
@@ -75,22 +214,31 @@ IOTJS_DEFINE_NATIVE_HANDLE_INFO_THIS_MODULE(http_parserwrap);
 
 
 static void iotjs_http_parserwrap_create(const jerry_value_t jparser,
-                                         http_parser_type type) {
-  iotjs_http_parserwrap_t* http_parserwrap =
-      IOTJS_ALLOC(iotjs_http_parserwrap_t);
+                                         http_parser_type type,
+                                         bool lazy_headers) {
+  iotjs_http_parserwrap_t* http_parserwrap;
+
+  if (parserwrap_pool_length > 0) {
+    http_parserwrap = parserwrap_pool[--parserwrap_pool_length];
+  } else {
+    http_parserwrap = IOTJS_ALLOC(iotjs_http_parserwrap_t);
+
+    http_parserwrap->url = iotjs_string_create();
+    http_parserwrap->status_msg = iotjs_string_create();
+    for (size_t i = 0; i < kCallbackCount; i++) {
+      http_parserwrap->callbacks[i] = jerry_create_undefined();
+    }
+  }
+
   http_parserwrap->jobject = jparser;
+  http_parserwrap->stream = NULL;
+  http_parserwrap->executing = false;
   jerry_set_object_native_pointer(jparser, http_parserwrap,
                                   &this_module_native_info);
 
-  http_parserwrap->url = iotjs_string_create();
-  http_parserwrap->status_msg = iotjs_string_create();
-  for (size_t i = 0; i < HEADER_MAX; i++) {
-    http_parserwrap->fields[i] = iotjs_string_create();
-    http_parserwrap->values[i] = iotjs_string_create();
-  }
-
   iotjs_http_parserwrap_initialize(http_parserwrap, type);
   http_parserwrap->parser.data = http_parserwrap;
+  http_parserwrap->lazy_headers = lazy_headers;
 
   IOTJS_ASSERT(jerry_value_is_object(http_parserwrap->jobject));
 }
@@ -101,20 +249,123 @@ static void iotjs_http_parserwrap_destroy(
   iotjs_string_destroy(&http_parserwrap->url);
   iotjs_string_destroy(&http_parserwrap->status_msg);
   for (size_t i = 0; i < HEADER_MAX; i++) {
-    iotjs_string_destroy(&http_parserwrap->fields[i]);
-    iotjs_string_destroy(&http_parserwrap->values[i]);
+    iotjs_http_header_slot_clear(&http_parserwrap->fields[i]);
+    iotjs_http_header_slot_clear(&http_parserwrap->values[i]);
+  }
+  for (size_t i = 0; i < kCallbackCount; i++) {
+    jerry_release_value(http_parserwrap->callbacks[i]);
+    http_parserwrap->callbacks[i] = jerry_create_undefined();
+  }
+
+  IOTJS_RELEASE(http_parserwrap->raw_headers);
+  IOTJS_RELEASE(http_parserwrap->raw_offsets);
+  http_parserwrap->raw_capacity = 0;
+  http_parserwrap->raw_offsets_capacity = 0;
+
+  if (parserwrap_pool_length < IOTJS_HTTP_PARSER_POOL_SIZE) {
+    parserwrap_pool[parserwrap_pool_length++] = http_parserwrap;
+    return;
   }
 
   IOTJS_RELEASE(http_parserwrap);
 }
 
 
+void iotjs_http_parser_release_header_names(void) {
+  for (size_t i = 0; i < COMMON_HEADER_COUNT; i++) {
+    for (size_t spelling = 0; spelling < 2; spelling++) {
+      if (common_header_jnames[i][spelling] != 0) {
+        jerry_release_value(common_header_jnames[i][spelling]);
+        common_header_jnames[i][spelling] = 0;
+      }
+    }
+  }
+}
+
+
+void iotjs_http_parser_pool_cleanup(void) {
+  while (parserwrap_pool_length > 0) {
+    IOTJS_RELEASE(parserwrap_pool[--parserwrap_pool_length]);
+  }
+}
+
+
+#define CALLBACK_ACCESSORS(NAME, INDEX)                                 \
+  JS_FUNCTION(NAME##_get) {                                             \
+    JS_DECLARE_THIS_PTR(http_parserwrap, parser);                       \
+    return jerry_acquire_value(parser->callbacks[INDEX]);               \
+  }                                                                     \
+  JS_FUNCTION(NAME##_set) {                                             \
+    JS_DECLARE_THIS_PTR(http_parserwrap, parser);                       \
+    jerry_release_value(parser->callbacks[INDEX]);                      \
+    parser->callbacks[INDEX] = jerry_acquire_value(                     \
+        jargc > 0 ? jargv[0] : jerry_create_undefined());               \
+    return jerry_create_undefined();                                    \
+  }
+
+CALLBACK_ACCESSORS(js_on_headers, kOnHeaders)
+CALLBACK_ACCESSORS(js_on_headers_complete, kOnHeadersComplete)
+CALLBACK_ACCESSORS(js_on_body, kOnBody)
+CALLBACK_ACCESSORS(js_on_message_complete, kOnMessageComplete)
+CALLBACK_ACCESSORS(js_on_execute_error, kOnExecuteError)
+
+#undef CALLBACK_ACCESSORS
+
+
+// Returns the interned string of a common header name, or 0 if the name
+// is not common or is spelled differently.
+static jerry_value_t iotjs_http_parser_common_header_name(const char* name,
+                                                         size_t size) {
+  for (size_t i = 0; i < COMMON_HEADER_COUNT; i++) {
+    const char* common = common_header_names[i].name;
+
+    // Letters differ in the 0x20 bit between the two spellings.
+    if (common_header_names[i].size != size ||
+        (name[0] | 0x20) != (common[0] | 0x20)) {
+      continue;
+    }
+
+    size_t spelling = 0;
+    if (memcmp(name, common, size) != 0) {
+      size_t j = 0;
+      for (; j < size; j++) {
+        char lower = common[j];
+        if (lower >= 'A' && lower <= 'Z') {
+          lower = (char)(lower + ('a' - 'A'));
+        }
+        if (name[j] != lower) {
+          break;
+        }
+      }
+      if (j < size) {
+        continue;
+      }
+      spelling = 1;
+    }
+
+    jerry_value_t* jname = &common_header_jnames[i][spelling];
+    if (*jname == 0) {
+      *jname = jerry_create_string_sz((const jerry_char_t*)name, size);
+    }
+    return jerry_acquire_value(*jname);
+  }
+
+  return 0;
+}
+
+
 static jerry_value_t iotjs_http_parserwrap_make_header(
     iotjs_http_parserwrap_t* http_parserwrap) {
   jerry_value_t jheader = jerry_create_array(http_parserwrap->n_values * 2);
   for (size_t i = 0; i < http_parserwrap->n_values; i++) {
-    jerry_value_t f = iotjs_jval_create_string(&http_parserwrap->fields[i]);
-    jerry_value_t v = iotjs_jval_create_string(&http_parserwrap->values[i]);
+    const iotjs_http_header_slot_t* field = &http_parserwrap->fields[i];
+    jerry_value_t f =
+        iotjs_http_parser_common_header_name(field->data, field->size);
+    if (f == 0) {
+      f = iotjs_http_header_slot_to_jstring(field);
+    }
+    jerry_value_t v =
+        iotjs_http_header_slot_to_jstring(&http_parserwrap->values[i]);
     iotjs_jval_set_property_by_index(jheader, i * 2, f);
     iotjs_jval_set_property_by_index(jheader, i * 2 + 1, v);
     jerry_release_value(f);
@@ -128,7 +379,7 @@ static void iotjs_http_parserwrap_flush(
     iotjs_http_parserwrap_t* http_parserwrap) {
   const jerry_value_t jobj = http_parserwrap->jobject;
   jerry_value_t func =
-      iotjs_jval_get_property(jobj, IOTJS_MAGIC_STRING_ONHEADERS);
+      jerry_acquire_value(http_parserwrap->callbacks[kOnHeaders]);
   IOTJS_ASSERT(jerry_value_is_function(func));
 
   jerry_value_t jheader = iotjs_http_parserwrap_make_header(http_parserwrap);
@@ -160,6 +411,97 @@ static void iotjs_http_parserwrap_set_buf(
 }
 
 
+static void iotjs_http_parserwrap_raw_append(
+    iotjs_http_parserwrap_t* http_parserwrap, const char* at, size_t length) {
+  size_t size = http_parserwrap->raw_size + length;
+
+  if (size > http_parserwrap->raw_capacity) {
+    size_t capacity = http_parserwrap->raw_capacity;
+    if (capacity == 0) {
+      capacity = 256;
+    }
+    while (capacity < size) {
+      capacity *= 2;
+    }
+
+    if (http_parserwrap->raw_headers == NULL) {
+      http_parserwrap->raw_headers = iotjs_buffer_allocate(capacity);
+    } else {
+      http_parserwrap->raw_headers =
+          iotjs_buffer_reallocate(http_parserwrap->raw_headers, capacity);
+    }
+    http_parserwrap->raw_capacity = capacity;
+  }
+
+  memcpy(http_parserwrap->raw_headers + http_parserwrap->raw_size, at, length);
+  http_parserwrap->raw_size = size;
+}
+
+
+// Marks the start of the next name or value in the raw headers.
+static void iotjs_http_parserwrap_raw_mark(
+    iotjs_http_parserwrap_t* http_parserwrap) {
+  if (http_parserwrap->raw_offsets_length ==
+      http_parserwrap->raw_offsets_capacity) {
+    size_t capacity = http_parserwrap->raw_offsets_capacity * 2;
+    if (capacity == 0) {
+      capacity = 16;
+    }
+
+    uint32_t* offsets = IOTJS_CALLOC(capacity, uint32_t);
+    if (http_parserwrap->raw_offsets_length > 0) {
+      memcpy(offsets, http_parserwrap->raw_offsets,
+             http_parserwrap->raw_offsets_length * sizeof(uint32_t));
+    }
+    IOTJS_RELEASE(http_parserwrap->raw_offsets);
+
+    http_parserwrap->raw_offsets = offsets;
+    http_parserwrap->raw_offsets_capacity = capacity;
+  }
+
+  http_parserwrap->raw_offsets[http_parserwrap->raw_offsets_length++] =
+      (uint32_t)http_parserwrap->raw_size;
+}
+
+
+// Passes the raw headers as a Buffer and the offsets of the names and
+// values in it: name `i` is between offsets 2 * i and 2 * i + 1, its value
+// is between offsets 2 * i + 1 and 2 * i + 2.
+static void iotjs_http_parserwrap_set_raw_headers(
+    iotjs_http_parserwrap_t* http_parserwrap, jerry_value_t info) {
+  if (http_parserwrap->n_fields != http_parserwrap->n_values) {
+    // The last value is empty.
+    iotjs_http_parserwrap_raw_mark(http_parserwrap);
+  }
+  iotjs_http_parserwrap_raw_mark(http_parserwrap);
+
+  size_t size = http_parserwrap->raw_size;
+  jerry_value_t jraw = iotjs_bufferwrap_create_buffer_uninitialized(size);
+  if (size > 0) {
+    iotjs_bufferwrap_copy(iotjs_bufferwrap_from_jbuffer(jraw),
+                          http_parserwrap->raw_headers, size);
+  }
+
+  size_t count = http_parserwrap->raw_offsets_length;
+  jerry_value_t joffsets = jerry_create_array((uint32_t)count);
+  for (size_t i = 0; i < count; i++) {
+    jerry_value_t joffset =
+        jerry_create_number(http_parserwrap->raw_offsets[i]);
+    iotjs_jval_set_property_by_index(joffsets, (uint32_t)i, joffset);
+    jerry_release_value(joffset);
+  }
+
+  iotjs_jval_set_property_by_key(info, IOTJS_KEY(RAWHEADERS), jraw);
+  iotjs_jval_set_property_by_key(info, IOTJS_KEY(RAWHEADEROFFSETS),
+                                 joffsets);
+  jerry_release_value(jraw);
+  jerry_release_value(joffsets);
+
+  http_parserwrap->raw_size = 0;
+  http_parserwrap->raw_offsets_length = 0;
+}
+
+
 // http-parser callbacks
 static int iotjs_http_parserwrap_on_message_begin(http_parser* parser) {
   iotjs_http_parserwrap_t* http_parserwrap =
@@ -193,6 +535,16 @@ static int iotjs_http_parserwrap_on_header_field(http_parser* parser,
                                                  size_t length) {
   iotjs_http_parserwrap_t* http_parserwrap =
       (iotjs_http_parserwrap_t*)(parser->data);
+
+  if (http_parserwrap->lazy_headers) {
+    if (http_parserwrap->n_fields == http_parserwrap->n_values) {
+      http_parserwrap->n_fields++;
+      iotjs_http_parserwrap_raw_mark(http_parserwrap);
+    }
+    iotjs_http_parserwrap_raw_append(http_parserwrap, at, length);
+    return 0;
+  }
+
   if (http_parserwrap->n_fields == http_parserwrap->n_values) {
     http_parserwrap->n_fields++;
     // values and fields are flushed to JS
@@ -202,12 +554,12 @@ static int iotjs_http_parserwrap_on_header_field(http_parser* parser,
       http_parserwrap->n_fields = 1;
       http_parserwrap->n_values = 0;
     }
-    iotjs_string_destroy(
+    iotjs_http_header_slot_clear(
         &http_parserwrap->fields[http_parserwrap->n_fields - 1]);
   }
   IOTJS_ASSERT(http_parserwrap->n_fields == http_parserwrap->n_values + 1);
-  iotjs_string_append(&http_parserwrap->fields[http_parserwrap->n_fields - 1],
-                      at, length);
+  iotjs_http_header_slot_append(
+      &http_parserwrap->fields[http_parserwrap->n_fields - 1], at, length);
 
   return 0;
 }
@@ -218,16 +570,26 @@ static int iotjs_http_parserwrap_on_header_value(http_parser* parser,
                                                  size_t length) {
   iotjs_http_parserwrap_t* http_parserwrap =
       (iotjs_http_parserwrap_t*)(parser->data);
+
+  if (http_parserwrap->lazy_headers) {
+    if (http_parserwrap->n_fields != http_parserwrap->n_values) {
+      http_parserwrap->n_values++;
+      iotjs_http_parserwrap_raw_mark(http_parserwrap);
+    }
+    iotjs_http_parserwrap_raw_append(http_parserwrap, at, length);
+    return 0;
+  }
+
   if (http_parserwrap->n_fields != http_parserwrap->n_values) {
     http_parserwrap->n_values++;
-    iotjs_string_destroy(
+    iotjs_http_header_slot_clear(
         &http_parserwrap->values[http_parserwrap->n_values - 1]);
   }
 
   IOTJS_ASSERT(http_parserwrap->n_fields == http_parserwrap->n_values);
 
-  iotjs_string_append(&http_parserwrap->values[http_parserwrap->n_values - 1],
-                      at, length);
+  iotjs_http_header_slot_append(
+      &http_parserwrap->values[http_parserwrap->n_values - 1], at, length);
 
   return 0;
 }
@@ -238,7 +600,7 @@ static int iotjs_http_parserwrap_on_headers_complete(http_parser* parser) {
       (iotjs_http_parserwrap_t*)(parser->data);
   const jerry_value_t jobj = http_parserwrap->jobject;
   jerry_value_t func =
-      iotjs_jval_get_property(jobj, IOTJS_MAGIC_STRING_ONHEADERSCOMPLETE);
+      jerry_acquire_value(http_parserwrap->callbacks[kOnHeadersComplete]);
   IOTJS_ASSERT(jerry_value_is_function(func));
 
   // URL
@@ -249,49 +611,57 @@ static int iotjs_http_parserwrap_on_headers_complete(http_parser* parser) {
     // flush the remaining headers.
     // In Flush function, url is already flushed to JS.
     iotjs_http_parserwrap_flush(http_parserwrap);
+  } else if (http_parserwrap->lazy_headers) {
+    // Lazy headers are never flushed, they are decoded by JS on demand.
+    iotjs_http_parserwrap_set_raw_headers(http_parserwrap, info);
+    if (http_parserwrap->parser.type == HTTP_REQUEST) {
+      IOTJS_ASSERT(!iotjs_string_is_empty(&http_parserwrap->url));
+      iotjs_jval_set_property_string_by_key(info, IOTJS_KEY(URL),
+                                            &http_parserwrap->url);
+    }
   } else {
     // Here, there was no flushed header.
     // We need to make a new header object with all header fields
     jerry_value_t jheader = iotjs_http_parserwrap_make_header(http_parserwrap);
-    iotjs_jval_set_property_jval(info, IOTJS_MAGIC_STRING_HEADERS, jheader);
+    iotjs_jval_set_property_by_key(info, IOTJS_KEY(HEADERS), jheader);
     jerry_release_value(jheader);
     if (http_parserwrap->parser.type == HTTP_REQUEST) {
       IOTJS_ASSERT(!iotjs_string_is_empty(&http_parserwrap->url));
-      iotjs_jval_set_property_string(info, IOTJS_MAGIC_STRING_URL,
-                                     &http_parserwrap->url);
+      iotjs_jval_set_property_string_by_key(info, IOTJS_KEY(URL),
+                                            &http_parserwrap->url);
     }
   }
   http_parserwrap->n_fields = http_parserwrap->n_values = 0;
 
   // Method
   if (http_parserwrap->parser.type == HTTP_REQUEST) {
-    iotjs_jval_set_property_number(info, IOTJS_MAGIC_STRING_METHOD,
-                                   http_parserwrap->parser.method);
+    iotjs_jval_set_property_number_by_key(info, IOTJS_KEY(METHOD),
+                                          http_parserwrap->parser.method);
   }
   // Status
   else if (http_parserwrap->parser.type == HTTP_RESPONSE) {
-    iotjs_jval_set_property_number(info, IOTJS_MAGIC_STRING_STATUS,
-                                   http_parserwrap->parser.status_code);
-    iotjs_jval_set_property_string(info, IOTJS_MAGIC_STRING_STATUS_MSG,
-                                   &http_parserwrap->status_msg);
+    iotjs_jval_set_property_number_by_key(info, IOTJS_KEY(STATUS),
+                                          http_parserwrap->parser.status_code);
+    iotjs_jval_set_property_string_by_key(info, IOTJS_KEY(STATUS_MSG),
+                                          &http_parserwrap->status_msg);
   }
 
 
   // For future support, current http_server module does not support
   // upgrade and keepalive.
   // upgrade
-  iotjs_jval_set_property_boolean(info, IOTJS_MAGIC_STRING_UPGRADE,
-                                  http_parserwrap->parser.upgrade);
+  iotjs_jval_set_property_boolean_by_key(info, IOTJS_KEY(UPGRADE),
+                                         http_parserwrap->parser.upgrade);
   // shouldkeepalive
-  iotjs_jval_set_property_boolean(info, IOTJS_MAGIC_STRING_SHOULDKEEPALIVE,
-                                  http_should_keep_alive(
-                                      &http_parserwrap->parser));
+  iotjs_jval_set_property_boolean_by_key(info, IOTJS_KEY(SHOULDKEEPALIVE),
+                                         http_should_keep_alive(
+                                             &http_parserwrap->parser));
 
   // http version number
-  iotjs_jval_set_property_number(info, IOTJS_MAGIC_STRING_HTTP_VERSION_MAJOR,
-                                 parser->http_major);
-  iotjs_jval_set_property_number(info, IOTJS_MAGIC_STRING_HTTP_VERSION_MINOR,
-                                 parser->http_minor);
+  iotjs_jval_set_property_number_by_key(info, IOTJS_KEY(HTTP_VERSION_MAJOR),
+                                        parser->http_major);
+  iotjs_jval_set_property_number_by_key(info, IOTJS_KEY(HTTP_VERSION_MINOR),
+                                        parser->http_minor);
 
   jerry_value_t res = iotjs_invoke_callback_with_result(func, jobj, &info, 1);
 
@@ -315,9 +685,16 @@ static int iotjs_http_parserwrap_on_body(http_parser* parser, const char* at,
   iotjs_http_parserwrap_t* http_parserwrap =
       (iotjs_http_parserwrap_t*)(parser->data);
   const jerry_value_t jobj = http_parserwrap->jobject;
-  jerry_value_t func = iotjs_jval_get_property(jobj, IOTJS_MAGIC_STRING_ONBODY);
+  jerry_value_t func = jerry_acquire_value(http_parserwrap->callbacks[kOnBody]);
   IOTJS_ASSERT(jerry_value_is_function(func));
 
+  if (jerry_value_is_null(http_parserwrap->cur_jbuf)) {
+    // Data of a consumed handle, the chunk becomes a Buffer only now.
+    http_parserwrap->cur_jbuf =
+        iotjs_bufferwrap_slab_create_buffer(http_parserwrap->cur_buf,
+                                            http_parserwrap->cur_buf_len);
+  }
+
   jerry_value_t argv[3] = { http_parserwrap->cur_jbuf,
                             jerry_create_number(at - http_parserwrap->cur_buf),
                             jerry_create_number(length) };
@@ -337,7 +714,7 @@ static int iotjs_http_parserwrap_on_message_complete(http_parser* parser) {
       (iotjs_http_parserwrap_t*)(parser->data);
   const jerry_value_t jobj = http_parserwrap->jobject;
   jerry_value_t func =
-      iotjs_jval_get_property(jobj, IOTJS_MAGIC_STRING_ONMESSAGECOMPLETE);
+      jerry_acquire_value(http_parserwrap->callbacks[kOnMessageComplete]);
   IOTJS_ASSERT(jerry_value_is_function(func));
 
   iotjs_invoke_callback(func, jobj, NULL, 0);
@@ -362,6 +739,21 @@ const struct http_parser_settings settings = {
 };
 
 
+// Runs the parser on `len` bytes. JS callbacks may free the parser while it
+// runs, `isExecuting()` tells them not to reuse it yet.
+static size_t iotjs_http_parserwrap_execute(
+    iotjs_http_parserwrap_t* http_parserwrap, const char* data, size_t len) {
+  bool executing = http_parserwrap->executing;
+  http_parserwrap->executing = true;
+
+  size_t nparsed =
+      http_parser_execute(&http_parserwrap->parser, &settings, data, len);
+
+  http_parserwrap->executing = executing;
+  return nparsed;
+}
+
+
 static jerry_value_t iotjs_http_parser_return_parserrror(
     http_parser* nativeparser) {
   enum http_errno err = HTTP_PARSER_ERRNO(nativeparser);
@@ -379,7 +771,7 @@ JS_FUNCTION(js_func_finish) {
   JS_DECLARE_THIS_PTR(http_parserwrap, parser);
 
   http_parser* nativeparser = &parser->parser;
-  size_t rv = http_parser_execute(nativeparser, &settings, NULL, 0);
+  size_t rv = iotjs_http_parserwrap_execute(parser, NULL, 0);
 
   if (rv != 0) {
     return iotjs_http_parser_return_parserrror(nativeparser);
@@ -402,8 +794,7 @@ JS_FUNCTION(js_func_execute) {
   iotjs_http_parserwrap_set_buf(parser, jbuffer, buf_data, buf_len);
 
   http_parser* nativeparser = &parser->parser;
-  size_t nparsed =
-      http_parser_execute(nativeparser, &settings, buf_data, buf_len);
+  size_t nparsed = iotjs_http_parserwrap_execute(parser, buf_data, buf_len);
 
   iotjs_http_parserwrap_set_buf(parser, jerry_create_null(), NULL, 0);
 
@@ -417,6 +808,130 @@ JS_FUNCTION(js_func_execute) {
 }
 
 
+static void iotjs_http_parserwrap_on_detach(void* consumer_data) {
+  iotjs_http_parserwrap_t* http_parserwrap =
+      (iotjs_http_parserwrap_t*)consumer_data;
+  http_parserwrap->stream = NULL;
+}
+
+
+static void iotjs_http_parserwrap_unconsume(
+    iotjs_http_parserwrap_t* http_parserwrap) {
+  if (http_parserwrap->stream != NULL) {
+    iotjs_tcp_set_consumer(http_parserwrap->stream, NULL, NULL,
+                           jerry_create_undefined());
+  }
+}
+
+
+// Parses the data read by the consumed handle. A parse error detaches the
+// parser and is passed to the `OnExecuteError` callback.
+static void iotjs_http_parserwrap_on_data(void* consumer_data, char* data,
+                                          size_t len) {
+  iotjs_http_parserwrap_t* http_parserwrap =
+      (iotjs_http_parserwrap_t*)consumer_data;
+  // The callbacks may unconsume the handle, which drops its reference.
+  jerry_value_t jobj = jerry_acquire_value(http_parserwrap->jobject);
+
+  // The Buffer of the chunk is created by the first body callback, if any.
+  iotjs_http_parserwrap_set_buf(http_parserwrap, jerry_create_null(), data,
+                                len);
+
+  http_parser* nativeparser = &http_parserwrap->parser;
+  size_t nparsed = iotjs_http_parserwrap_execute(http_parserwrap, data, len);
+
+  jerry_release_value(http_parserwrap->cur_jbuf);
+  iotjs_http_parserwrap_set_buf(http_parserwrap, jerry_create_null(), NULL, 0);
+
+  if (!nativeparser->upgrade && nparsed != len &&
+      http_parserwrap->stream != NULL) {
+    iotjs_http_parserwrap_unconsume(http_parserwrap);
+
+    jerry_value_t func =
+        jerry_acquire_value(http_parserwrap->callbacks[kOnExecuteError]);
+    if (jerry_value_is_function(func)) {
+      jerry_value_t jerror = iotjs_http_parser_return_parserrror(nativeparser);
+      iotjs_invoke_callback(func, jobj, &jerror, 1);
+      jerry_release_value(jerror);
+    }
+    jerry_release_value(func);
+  }
+
+  jerry_release_value(jobj);
+}
+
+
+static const iotjs_tcp_consumer_t http_parser_consumer = {
+  iotjs_http_parserwrap_on_data, iotjs_http_parserwrap_on_detach,
+};
+
+
+// Parses the data read by a TCP handle straight from its read callback,
+// instead of taking it from `execute` calls. Returns false if `handle` is
+// not an open TCP handle.
+// [0] handle
+JS_FUNCTION(js_func_consume) {
+  JS_DECLARE_THIS_PTR(http_parserwrap, parser);
+
+  uv_stream_t* stream =
+      iotjs_tcp_from_jobject(jargc > 0 ? jargv[0] : jerry_create_undefined());
+
+  if (stream == NULL) {
+    return jerry_create_boolean(false);
+  }
+
+  iotjs_http_parserwrap_unconsume(parser);
+
+  if (!iotjs_tcp_set_consumer(stream, &http_parser_consumer, parser,
+                              parser->jobject)) {
+    return jerry_create_boolean(false);
+  }
+
+  parser->stream = stream;
+  return jerry_create_boolean(true);
+}
+
+
+JS_FUNCTION(js_func_unconsume) {
+  JS_DECLARE_THIS_PTR(http_parserwrap, parser);
+
+  iotjs_http_parserwrap_unconsume(parser);
+  return jerry_create_undefined();
+}
+
+
+JS_FUNCTION(js_func_is_executing) {
+  JS_DECLARE_THIS_PTR(http_parserwrap, parser);
+
+  return jerry_create_boolean(parser->executing);
+}
+
+
+// Resets the parser for a new connection.
+// [0] parser type
+// [1] lazy headers, see iotjs_http_parserwrap_set_raw_headers
+JS_FUNCTION(js_func_reinitialize) {
+  JS_DECLARE_THIS_PTR(http_parserwrap, parser);
+  DJS_CHECK_ARGS(1, number);
+
+  http_parser_type type = (http_parser_type)(JS_GET_ARG(0, number));
+
+  if (type != HTTP_REQUEST && type != HTTP_RESPONSE) {
+    return JS_CREATE_ERROR(TYPE, "Invalid type of HTTP.");
+  }
+
+  // Release the headers of the last message.
+  for (size_t i = 0; i < HEADER_MAX; i++) {
+    iotjs_http_header_slot_clear(&parser->fields[i]);
+    iotjs_http_header_slot_clear(&parser->values[i]);
+  }
+  iotjs_http_parserwrap_initialize(parser, type);
+  parser->lazy_headers = jargc > 1 && jerry_value_to_boolean(jargv[1]);
+
+  return jerry_create_undefined();
+}
+
+
 static jerry_value_t iotjs_http_parser_pause(jerry_value_t jthis, int paused) {
   JS_DECLARE_THIS_PTR(http_parserwrap, parser);
 
@@ -448,7 +963,8 @@ JS_FUNCTION(http_parser_cons) {
     return JS_CREATE_ERROR(TYPE, "Invalid type of HTTP.");
   }
 
-  iotjs_http_parserwrap_create(jparser, httpparser_type);
+  bool lazy_headers = jargc > 1 && jerry_value_to_boolean(jargv[1]);
+  iotjs_http_parserwrap_create(jparser, httpparser_type, lazy_headers);
   return jerry_create_undefined();
 }
 
@@ -485,10 +1001,30 @@ jerry_value_t iotjs_init_http_parser(void) {
 
   jerry_value_t prototype = jerry_create_object();
 
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONHEADERS,
+                          js_on_headers_get, js_on_headers_set);
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONHEADERSCOMPLETE,
+                          js_on_headers_complete_get,
+                          js_on_headers_complete_set);
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONBODY,
+                          js_on_body_get, js_on_body_set);
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONMESSAGECOMPLETE,
+                          js_on_message_complete_get,
+                          js_on_message_complete_set);
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONEXECUTEERROR,
+                          js_on_execute_error_get, js_on_execute_error_set);
+
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_EXECUTE, js_func_execute);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_FINISH, js_func_finish);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_REINITIALIZE,
+                        js_func_reinitialize);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_PAUSE, js_func_pause);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_RESUME, js_func_resume);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_CONSUME, js_func_consume);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_UNCONSUME,
+                        js_func_unconsume);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_ISEXECUTING,
+                        js_func_is_executing);
 
   iotjs_jval_set_property_jval(jparser_cons, IOTJS_MAGIC_STRING_PROTOTYPE,
                                prototype);
@@ -0,0 +1,28 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IOTJS_MODULE_HTTP_PARSER_H
+#define IOTJS_MODULE_HTTP_PARSER_H
+
+
+// Releases the interned header names, before the engine is cleaned up.
+void iotjs_http_parser_release_header_names(void);
+
+// Releases the wrappers of collected parsers kept for reuse. All parsers
+// must be collected by now.
+void iotjs_http_parser_pool_cleanup(void);
+
+
+#endif /* IOTJS_MODULE_HTTP_PARSER_H */
@@ -16,6 +16,8 @@
 #include "iotjs_def.h"
 #include "iotjs_compatibility.h"
 #include "iotjs_js.h"
+#include "iotjs_tick.h"
+#include "iotjs_uv_pool.h"
 #include "jerryscript-debugger.h"
 #include <stdlib.h>
 #ifndef WIN32
@@ -111,6 +113,19 @@ JS_FUNCTION(debugger_get_source) {
 #endif
 
 
+// Looks up a builtin JS module in the hash table generated by js2c.py.
+static const iotjs_js_module_t* find_js_module(const char* name) {
+  uint32_t hash = iotjs_module_hash(name, JS_MODULES_HASH_SEED);
+  uint16_t index = js_modules_hash[hash & JS_MODULES_HASH_MASK];
+
+  if (index == 0 || strcmp(js_modules[index - 1].name, name)) {
+    return NULL;
+  }
+
+  return &js_modules[index - 1];
+}
+
+
 JS_FUNCTION(proc_compile_module) {
   DJS_CHECK_ARGS(2, object, function);
 
@@ -125,14 +140,7 @@ JS_FUNCTION(proc_compile_module) {
   jerry_release_value(jid);
   const char* name = iotjs_string_data(&id);
 
-  int i = 0;
-  while (js_modules[i].name != NULL) {
-    if (!strcmp(js_modules[i].name, name)) {
-      break;
-    }
-
-    i++;
-  }
+  const iotjs_js_module_t* js_module = find_js_module(name);
 
   jerry_value_t native_module_jval = iotjs_module_get(name);
 
@@ -143,14 +151,14 @@ JS_FUNCTION(proc_compile_module) {
 
   jerry_value_t jres = jerry_create_undefined();
 
-  if (js_modules[i].name != NULL) {
+  if (js_module != NULL) {
 #ifdef ENABLE_SNAPSHOT
     jres = jerry_exec_snapshot((const uint32_t*)iotjs_js_modules_s,
-                               iotjs_js_modules_l, js_modules[i].idx,
+                               iotjs_js_modules_l, js_module->idx,
                                JERRY_SNAPSHOT_EXEC_ALLOW_STATIC);
 #else
     jres = wrap_eval(name, iotjs_string_size(&id),
-                     (const char*)js_modules[i].code, js_modules[i].length);
+                     (const char*)js_module->code, js_module->length);
 #endif
     if (!jerry_value_is_error(jres)) {
       jerry_value_t jexports = iotjs_jval_get_property(jmodule, "exports");
@@ -253,6 +261,29 @@ JS_FUNCTION(proc_do_exit) {
 }
 
 
+// Queues `callback(...args)` to run after the current callback returns.
+JS_FUNCTION(proc_next_tick) {
+  if (jargc < 1 || !jerry_value_is_function(jargv[0])) {
+    return JS_CREATE_ERROR(TYPE, "Bad arguments: callback must be a Function");
+  }
+
+  iotjs_tick_push(jargv[0], jargv + 1, jargc - 1);
+
+  return jerry_create_undefined();
+}
+
+
+// Runs the queued ticks, returns `true` if they queued more.
+JS_FUNCTION(proc_on_next_tick) {
+  return jerry_create_boolean(iotjs_process_next_tick());
+}
+
+
+JS_FUNCTION(proc_uv_pool_stats) {
+  return iotjs_uv_pool_stats();
+}
+
+
 static void set_process_env(jerry_value_t process) {
   const char *homedir, *iotjspath, *iotjsenv, *extra_module_path,
       *working_dir_path;
@@ -373,6 +404,11 @@ jerry_value_t iotjs_init_process(void) {
   iotjs_jval_set_method(process, IOTJS_MAGIC_STRING_CWD, proc_cwd);
   iotjs_jval_set_method(process, IOTJS_MAGIC_STRING_CHDIR, proc_chdir);
   iotjs_jval_set_method(process, IOTJS_MAGIC_STRING_DOEXIT, proc_do_exit);
+  iotjs_jval_set_method(process, IOTJS_MAGIC_STRING_NEXTTICK, proc_next_tick);
+  iotjs_jval_set_method(process, IOTJS_MAGIC_STRING__ONNEXTTICK,
+                        proc_on_next_tick);
+  iotjs_jval_set_method(process, IOTJS_MAGIC_STRING_UVPOOLSTATS,
+                        proc_uv_pool_stats);
 #ifdef EXPOSE_GC
   iotjs_jval_set_method(process, IOTJS_MAGIC_STRING_GC, garbage_collector);
 #endif
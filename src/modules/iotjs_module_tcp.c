@@ -24,13 +24,102 @@
 static const jerry_object_native_info_t this_module_native_info = { NULL };
 
 
+// Stored in the handle extra data.
+typedef struct {
+  // Loop time of the last I/O on the socket. Idle timeouts compare it
+  // against the loop time lazily when they expire.
+  uint64_t last_active;
+  const iotjs_tcp_consumer_t* consumer;
+  void* consumer_data;
+  jerry_value_t jconsumer;
+} iotjs_tcp_data_t;
+
+#define IOTJS_TCP_DATA(HANDLE) \
+  ((iotjs_tcp_data_t*)IOTJS_UV_HANDLE_EXTRA_DATA(HANDLE))
+
+#define IOTJS_TCP_LAST_ACTIVE(HANDLE) (IOTJS_TCP_DATA(HANDLE)->last_active)
+
+
+// Slots of the handle caching the `owner` and `onread` properties.
+#define IOTJS_TCP_SLOT_OWNER 0
+#define IOTJS_TCP_SLOT_ONREAD 1
+
+IOTJS_UV_HANDLE_SLOT_ACCESSORS(tcp_owner, IOTJS_TCP_SLOT_OWNER)
+IOTJS_UV_HANDLE_SLOT_ACCESSORS(tcp_onread, IOTJS_TCP_SLOT_ONREAD)
+
+
+static void iotjs_tcp_touch(uv_stream_t* handle) {
+  IOTJS_TCP_LAST_ACTIVE(handle) = uv_now(handle->loop);
+}
+
+
+static void iotjs_tcp_release_consumer(uv_stream_t* handle) {
+  iotjs_tcp_data_t* tcp_data = IOTJS_TCP_DATA(handle);
+
+  if (tcp_data->consumer != NULL) {
+    const iotjs_tcp_consumer_t* consumer = tcp_data->consumer;
+    tcp_data->consumer = NULL;
+    consumer->on_detach(tcp_data->consumer_data);
+  }
+
+  jerry_release_value(tcp_data->jconsumer);
+  tcp_data->jconsumer = jerry_create_undefined();
+  tcp_data->consumer_data = NULL;
+}
+
+
+static void iotjs_tcp_on_close(uv_handle_t* handle) {
+  iotjs_tcp_release_consumer((uv_stream_t*)handle);
+}
+
+
 void iotjs_tcp_object_init(jerry_value_t jtcp) {
   // uv_tcp_t* can be handled as uv_handle_t* or even as uv_stream_t*
-  uv_handle_t* handle = iotjs_uv_handle_create(sizeof(uv_tcp_t), jtcp,
-                                               &this_module_native_info, 0);
+  uv_handle_t* handle =
+      iotjs_uv_handle_create(sizeof(uv_tcp_t), jtcp, &this_module_native_info,
+                             sizeof(iotjs_tcp_data_t));
 
   const iotjs_environment_t* env = iotjs_environment_get();
   uv_tcp_init(iotjs_environment_loop(env), (uv_tcp_t*)handle);
+  iotjs_tcp_touch((uv_stream_t*)handle);
+
+  // Handles closed without tcp_close, like those left open at exit, still
+  // release their consumer.
+  IOTJS_UV_HANDLE_DATA(handle)->on_close_cb = iotjs_tcp_on_close;
+  IOTJS_TCP_DATA(handle)->jconsumer = jerry_create_undefined();
+}
+
+
+uv_stream_t* iotjs_tcp_from_jobject(jerry_value_t jtcp) {
+  void* handle = NULL;
+
+  if (!jerry_value_is_object(jtcp) ||
+      !jerry_get_object_native_pointer(jtcp, &handle,
+                                       &this_module_native_info)) {
+    return NULL;
+  }
+
+  return (uv_stream_t*)handle;
+}
+
+
+bool iotjs_tcp_set_consumer(uv_stream_t* handle,
+                            const iotjs_tcp_consumer_t* consumer,
+                            void* consumer_data, jerry_value_t jconsumer) {
+  if (consumer != NULL && uv_is_closing((uv_handle_t*)handle)) {
+    return false;
+  }
+
+  iotjs_tcp_release_consumer(handle);
+
+  if (consumer != NULL) {
+    iotjs_tcp_data_t* tcp_data = IOTJS_TCP_DATA(handle);
+    tcp_data->consumer = consumer;
+    tcp_data->consumer_data = consumer_data;
+    tcp_data->jconsumer = jerry_acquire_value(jconsumer);
+  }
+
+  return true;
 }
 
 
@@ -66,9 +155,11 @@ JS_FUNCTION(tcp_constructor) {
 void after_close(uv_handle_t* handle) {
   jerry_value_t jtcp = IOTJS_UV_HANDLE_DATA(handle)->jobject;
 
+  iotjs_tcp_release_consumer((uv_stream_t*)handle);
+
   // callback function.
   jerry_value_t jcallback =
-      iotjs_jval_get_property(jtcp, IOTJS_MAGIC_STRING_ONCLOSE);
+      iotjs_jval_get_property_by_key(jtcp, IOTJS_KEY(ONCLOSE));
   if (jerry_value_is_function(jcallback)) {
     iotjs_invoke_callback(jcallback, jerry_create_undefined(), NULL, 0);
   }
@@ -94,17 +185,18 @@ JS_FUNCTION(tcp_bind) {
 
   DJS_CHECK_ARGS(2, string, number);
 
-  iotjs_string_t address = JS_GET_ARG(0, string);
+  iotjs_stack_string_t address;
+  iotjs_jval_as_stack_string(jargv[0], &address);
   int port = JS_GET_ARG(1, number);
 
   sockaddr_in addr;
-  int err = uv_ip4_addr(iotjs_string_data(&address), port, &addr);
+  int err = uv_ip4_addr(address.data, port, &addr);
 
   if (err == 0) {
     err = uv_tcp_bind(tcp_handle, (const sockaddr*)(&addr), 0);
   }
 
-  iotjs_string_destroy(&address);
+  iotjs_free_stack_string(&address);
 
   return jerry_create_number(err);
 }
@@ -112,6 +204,7 @@ JS_FUNCTION(tcp_bind) {
 
 // Connection request result handler.
 static void after_connect(uv_connect_t* req, int status) {
+  iotjs_tcp_touch(req->handle);
   iotjs_tcp_report_req_result((uv_req_t*)req, status);
 }
 
@@ -124,12 +217,13 @@ JS_FUNCTION(tcp_connect) {
 
   DJS_CHECK_ARGS(3, string, number, function);
 
-  iotjs_string_t address = JS_GET_ARG(0, string);
+  iotjs_stack_string_t address;
+  iotjs_jval_as_stack_string(jargv[0], &address);
   int port = JS_GET_ARG(1, number);
   jerry_value_t jcallback = JS_GET_ARG(2, function);
 
   sockaddr_in addr;
-  int err = uv_ip4_addr(iotjs_string_data(&address), port, &addr);
+  int err = uv_ip4_addr(address.data, port, &addr);
 
   if (err == 0) {
     // Create connection request and configure request data.
@@ -145,7 +239,7 @@ JS_FUNCTION(tcp_connect) {
     }
   }
 
-  iotjs_string_destroy(&address);
+  iotjs_free_stack_string(&address);
 
   return jerry_create_number(err);
 }
@@ -160,7 +254,7 @@ static void on_connection(uv_stream_t* handle, int status) {
 
   // `onconnection` callback.
   jerry_value_t jonconnection =
-      iotjs_jval_get_property(jtcp, IOTJS_MAGIC_STRING_ONCONNECTION);
+      iotjs_jval_get_property_by_key(jtcp, IOTJS_KEY(ONCONNECTION));
   IOTJS_ASSERT(jerry_value_is_function(jonconnection));
 
   // The callback takes two parameter
@@ -172,7 +266,7 @@ static void on_connection(uv_stream_t* handle, int status) {
   if (status == 0) {
     // Create client socket handle wrapper.
     jerry_value_t jcreate_tcp =
-        iotjs_jval_get_property(jtcp, IOTJS_MAGIC_STRING_CREATETCP);
+        iotjs_jval_get_property_by_key(jtcp, IOTJS_KEY(CREATETCP));
     IOTJS_ASSERT(jerry_value_is_function(jcreate_tcp));
 
     jerry_value_t jclient_tcp =
@@ -215,30 +309,140 @@ JS_FUNCTION(tcp_listen) {
 }
 
 
-void AfterWrite(uv_write_t* req, int status) {
+// Returns the Buffer to write for `jchunk`. Strings are encoded straight into
+// a new Buffer. Returns undefined for any other value.
+static jerry_value_t tcp_write_chunk(const jerry_value_t jchunk) {
+  if (jerry_value_is_string(jchunk)) {
+    return iotjs_bufferwrap_create_buffer_from_string(jchunk);
+  }
+
+  if (iotjs_jbuffer_get_bufferwrap_ptr(jchunk) == NULL) {
+    return jerry_create_undefined();
+  }
+
+  return jerry_acquire_value(jchunk);
+}
+
+
+static void AfterWrite(uv_write_t* req, int status) {
+  // The chunks are referenced until libuv is done with their memory.
+  jerry_value_t* jchunks =
+      (jerry_value_t*)IOTJS_UV_REQUEST_EXTRA_DATA((uv_req_t*)req);
+  jerry_release_value(*jchunks);
+
+  iotjs_tcp_touch(req->handle);
   iotjs_tcp_report_req_result((uv_req_t*)req, status);
 }
 
 
+// Writes a Buffer or a string.
+// [0] chunk
+// [1] callback
 JS_FUNCTION(tcp_write) {
   JS_DECLARE_PTR(jthis, uv_stream_t, tcp_handle);
-  DJS_CHECK_ARGS(2, object, function);
+  DJS_CHECK_ARGS(2, any, function);
+
+  jerry_value_t jbuffer = tcp_write_chunk(jargv[0]);
+
+  if (jerry_value_is_undefined(jbuffer)) {
+    return JS_CREATE_ERROR(TYPE, "Bad arguments: write(Buffer|string, cb)");
+  }
 
-  const jerry_value_t jbuffer = JS_GET_ARG(0, object);
   iotjs_bufferwrap_t* buffer_wrap = iotjs_bufferwrap_from_jbuffer(jbuffer);
-  size_t len = iotjs_bufferwrap_length(buffer_wrap);
 
   uv_buf_t buf;
   buf.base = buffer_wrap->buffer;
-  buf.len = len;
+  buf.len = iotjs_bufferwrap_length(buffer_wrap);
 
-  jerry_value_t arg1 = JS_GET_ARG(1, object);
-  uv_req_t* req_write = iotjs_uv_request_create(sizeof(uv_write_t), arg1, 0);
+  jerry_value_t jcallback = JS_GET_ARG(1, function);
+  uv_req_t* req_write = iotjs_uv_request_create(sizeof(uv_write_t), jcallback,
+                                                sizeof(jerry_value_t));
+  *(jerry_value_t*)IOTJS_UV_REQUEST_EXTRA_DATA(req_write) = jbuffer;
 
   int err = uv_write((uv_write_t*)req_write, tcp_handle, &buf, 1, AfterWrite);
 
   if (err) {
+    jerry_release_value(jbuffer);
     iotjs_uv_request_destroy((uv_req_t*)req_write);
+  } else {
+    iotjs_tcp_touch(tcp_handle);
+  }
+
+  return jerry_create_number(err);
+}
+
+
+// Number of chunks a vectored write can describe without a heap allocation.
+#define IOTJS_TCP_WRITEV_STACK_BUFS 16
+
+// Writes an array of Buffers and strings with a single request. String
+// chunks are replaced in the array by the Buffers they are encoded into.
+// [0] chunks
+// [1] callback
+JS_FUNCTION(tcp_writev) {
+  JS_DECLARE_PTR(jthis, uv_stream_t, tcp_handle);
+  DJS_CHECK_ARGS(2, array, function);
+
+  const jerry_value_t jchunks = jargv[0];
+  uint32_t count = jerry_get_array_length(jchunks);
+
+  // libuv does not accept a write without buffers.
+  if (count == 0) {
+    return jerry_create_number(UV_EINVAL);
+  }
+
+  uv_buf_t stack_bufs[IOTJS_TCP_WRITEV_STACK_BUFS];
+  uv_buf_t* bufs = stack_bufs;
+
+  if (count > IOTJS_TCP_WRITEV_STACK_BUFS) {
+    bufs = IOTJS_CALLOC(count, uv_buf_t);
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    jerry_value_t jchunk = jerry_get_property_by_index(jchunks, i);
+    jerry_value_t jbuffer = tcp_write_chunk(jchunk);
+
+    if (jerry_value_is_undefined(jbuffer)) {
+      jerry_release_value(jchunk);
+      if (bufs != stack_bufs) {
+        IOTJS_RELEASE(bufs);
+      }
+      return JS_CREATE_ERROR(TYPE,
+                             "Bad arguments: writev([Buffer|string], cb)");
+    }
+
+    if (jbuffer != jchunk) {
+      // The array keeps the encoded string alive during the write.
+      iotjs_jval_set_property_by_index(jchunks, i, jbuffer);
+    }
+    jerry_release_value(jchunk);
+
+    iotjs_bufferwrap_t* buffer_wrap = iotjs_bufferwrap_from_jbuffer(jbuffer);
+    bufs[i].base = buffer_wrap->buffer;
+    bufs[i].len = buffer_wrap->length;
+
+    jerry_release_value(jbuffer);
+  }
+
+  jerry_value_t jcallback = JS_GET_ARG(1, function);
+  uv_req_t* req_write = iotjs_uv_request_create(sizeof(uv_write_t), jcallback,
+                                                sizeof(jerry_value_t));
+  *(jerry_value_t*)IOTJS_UV_REQUEST_EXTRA_DATA(req_write) =
+      jerry_acquire_value(jchunks);
+
+  // libuv keeps its own copy of the descriptors.
+  int err =
+      uv_write((uv_write_t*)req_write, tcp_handle, bufs, count, AfterWrite);
+
+  if (err) {
+    jerry_release_value(jchunks);
+    iotjs_uv_request_destroy((uv_req_t*)req_write);
+  } else {
+    iotjs_tcp_touch(tcp_handle);
+  }
+
+  if (bufs != stack_bufs) {
+    IOTJS_RELEASE(bufs);
   }
 
   return jerry_create_number(err);
@@ -251,22 +455,32 @@ static void on_alloc(uv_handle_t* handle, size_t suggested_size,
     suggested_size = IOTJS_MAX_READ_BUFFER_SIZE;
   }
 
-  buf->base = iotjs_buffer_allocate(suggested_size);
+  // Data is received straight into the storage of the Buffer passed to JS.
+  buf->base = iotjs_bufferwrap_slab_allocate(suggested_size);
   buf->len = suggested_size;
 }
 
 
 static void on_read(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
-  jerry_value_t jtcp = IOTJS_UV_HANDLE_DATA(handle)->jobject;
+  if (nread != 0) {
+    iotjs_tcp_touch(handle);
+  }
+
+  iotjs_tcp_data_t* tcp_data = IOTJS_TCP_DATA(handle);
+  if (nread > 0 && tcp_data->consumer != NULL) {
+    tcp_data->consumer->on_data(tcp_data->consumer_data, buf->base,
+                                (size_t)nread);
+    return;
+  }
 
   // socket object
-  jerry_value_t jsocket =
-      iotjs_jval_get_property(jtcp, IOTJS_MAGIC_STRING_OWNER);
+  jerry_value_t jsocket = jerry_acquire_value(
+      IOTJS_UV_HANDLE_SLOT(handle, IOTJS_TCP_SLOT_OWNER));
   IOTJS_ASSERT(jerry_value_is_object(jsocket));
 
   // onread callback
-  jerry_value_t jonread =
-      iotjs_jval_get_property(jtcp, IOTJS_MAGIC_STRING_ONREAD);
+  jerry_value_t jonread = jerry_acquire_value(
+      IOTJS_UV_HANDLE_SLOT(handle, IOTJS_TCP_SLOT_ONREAD));
   IOTJS_ASSERT(jerry_value_is_function(jonread));
 
   size_t argc = 3;
@@ -274,8 +488,6 @@ static void on_read(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
                              jerry_create_boolean(false), 0 };
 
   if (nread <= 0) {
-    iotjs_buffer_release(buf->base);
-
     if (nread < 0) {
       if (nread == UV__EOF) {
         jargs[2] = jerry_create_boolean(true);
@@ -284,15 +496,11 @@ static void on_read(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf) {
       iotjs_invoke_callback(jonread, jerry_create_undefined(), jargs, argc);
     }
   } else {
-    jerry_value_t jbuffer = iotjs_bufferwrap_create_buffer((size_t)nread);
-    iotjs_bufferwrap_t* buffer_wrap = iotjs_bufferwrap_from_jbuffer(jbuffer);
-
-    iotjs_bufferwrap_copy(buffer_wrap, buf->base, (size_t)nread);
+    jerry_value_t jbuffer =
+        iotjs_bufferwrap_slab_create_buffer(buf->base, (size_t)nread);
 
     jargs[argc++] = jbuffer;
     iotjs_invoke_callback(jonread, jerry_create_undefined(), jargs, argc);
-
-    iotjs_buffer_release(buf->base);
   }
 
   for (uint8_t i = 0; i < argc; i++) {
@@ -311,6 +519,25 @@ JS_FUNCTION(tcp_read_start) {
 }
 
 
+// Returns the milliseconds passed since the last I/O on the socket.
+JS_FUNCTION(tcp_idle_time) {
+  JS_DECLARE_PTR(jthis, uv_stream_t, tcp_handle);
+
+  uint64_t idle = uv_now(tcp_handle->loop) - IOTJS_TCP_LAST_ACTIVE(tcp_handle);
+
+  return jerry_create_number((double)idle);
+}
+
+
+JS_FUNCTION(tcp_read_stop) {
+  JS_DECLARE_PTR(jthis, uv_stream_t, tcp_handle);
+
+  int err = uv_read_stop(tcp_handle);
+
+  return jerry_create_number(err);
+}
+
+
 static void AfterShutdown(uv_shutdown_t* req, int status) {
   iotjs_tcp_report_req_result((uv_req_t*)req, status);
 }
@@ -372,10 +599,9 @@ void address_to_js(jerry_value_t obj, const sockaddr* addr) {
       a6 = (const sockaddr_in6*)(addr);
       uv_inet_ntop(AF_INET6, &a6->sin6_addr, ip, sizeof ip);
       port = ntohs(a6->sin6_port);
-      iotjs_jval_set_property_string_raw(obj, IOTJS_MAGIC_STRING_ADDRESS, ip);
-      iotjs_jval_set_property_string_raw(obj, IOTJS_MAGIC_STRING_FAMILY,
-                                         IOTJS_MAGIC_STRING_IPV6);
-      iotjs_jval_set_property_number(obj, IOTJS_MAGIC_STRING_PORT, port);
+      iotjs_jval_set_property_string_raw_by_key(obj, IOTJS_KEY(ADDRESS), ip);
+      iotjs_jval_set_property_by_key(obj, IOTJS_KEY(FAMILY), IOTJS_KEY(IPV6));
+      iotjs_jval_set_property_number_by_key(obj, IOTJS_KEY(PORT), port);
       break;
     }
 
@@ -383,15 +609,14 @@ void address_to_js(jerry_value_t obj, const sockaddr* addr) {
       a4 = (const sockaddr_in*)(addr);
       uv_inet_ntop(AF_INET, &a4->sin_addr, ip, sizeof ip);
       port = ntohs(a4->sin_port);
-      iotjs_jval_set_property_string_raw(obj, IOTJS_MAGIC_STRING_ADDRESS, ip);
-      iotjs_jval_set_property_string_raw(obj, IOTJS_MAGIC_STRING_FAMILY,
-                                         IOTJS_MAGIC_STRING_IPV4);
-      iotjs_jval_set_property_number(obj, IOTJS_MAGIC_STRING_PORT, port);
+      iotjs_jval_set_property_string_raw_by_key(obj, IOTJS_KEY(ADDRESS), ip);
+      iotjs_jval_set_property_by_key(obj, IOTJS_KEY(FAMILY), IOTJS_KEY(IPV4));
+      iotjs_jval_set_property_number_by_key(obj, IOTJS_KEY(PORT), port);
       break;
     }
 
     default: {
-      iotjs_jval_set_property_string_raw(obj, IOTJS_MAGIC_STRING_ADDRESS, "");
+      iotjs_jval_set_property_string_raw_by_key(obj, IOTJS_KEY(ADDRESS), "");
       break;
     }
   }
@@ -420,13 +645,23 @@ jerry_value_t iotjs_init_tcp(void) {
   iotjs_jval_set_property_jval(tcp, IOTJS_MAGIC_STRING_PROTOTYPE, prototype);
   iotjs_jval_set_method(tcp, IOTJS_MAGIC_STRING_ERRNAME, tcp_err_name);
 
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_OWNER, tcp_owner_get,
+                          tcp_owner_set);
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONREAD, tcp_onread_get,
+                          tcp_onread_set);
+
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_CLOSE, tcp_close);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_CONNECT, tcp_connect);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_BIND, tcp_bind);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_LISTEN, tcp_listen);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_WRITE, tcp_write);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_WRITEV, tcp_writev);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_READSTART,
                         tcp_read_start);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_READSTOP,
+                        tcp_read_stop);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_IDLETIME,
+                        tcp_idle_time);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_SHUTDOWN, tcp_shutdown);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_SETKEEPALIVE,
                         tcp_set_keep_alive);
@@ -18,6 +18,8 @@
 #define IOTJS_MODULE_TCP_H
 
 
+#include <uv.h>
+
 #include "iotjs_binding.h"
 
 
@@ -30,4 +32,29 @@ typedef struct sockaddr_storage sockaddr_storage;
 void address_to_js(jerry_value_t obj, const sockaddr* addr);
 
 
+/**
+ * A native consumer of the data read by a TCP handle.
+ *
+ * While a consumer is set, the received bytes are passed to `on_data`
+ * instead of the `onread` callback of the handle, so no Buffer is created
+ * for them unless the consumer does it. EOF and read errors still go to
+ * `onread`.
+ */
+typedef struct {
+  // `data` is in the read slab, see iotjs_bufferwrap_slab_allocate.
+  void (*on_data)(void* consumer_data, char* data, size_t len);
+  // Called when the consumer is replaced, removed, or the handle closed.
+  void (*on_detach)(void* consumer_data);
+} iotjs_tcp_consumer_t;
+
+// Returns the handle of a TCP object, or NULL for any other value.
+uv_stream_t* iotjs_tcp_from_jobject(jerry_value_t jtcp);
+
+// Sets the consumer of the handle, NULL removes it. `jconsumer` is kept
+// alive while the consumer is set. Returns false if the handle is closing.
+bool iotjs_tcp_set_consumer(uv_stream_t* handle,
+                            const iotjs_tcp_consumer_t* consumer,
+                            void* consumer_data, jerry_value_t jconsumer);
+
+
 #endif /* IOTJS_MODULE_TCP_H */
@@ -14,16 +14,26 @@
  */
 
 #include "iotjs_def.h"
+#include "iotjs_tick.h"
 #include "iotjs_uv_handle.h"
 
 
 static const jerry_object_native_info_t this_module_native_info = { NULL };
 
+// Slot of the handle caching the `handleTimeout` method.
+#define IOTJS_TIMER_SLOT_HANDLETIMEOUT 0
+
 
 void iotjs_timer_object_init(jerry_value_t jtimer) {
   uv_handle_t* handle = iotjs_uv_handle_create(sizeof(uv_timer_t), jtimer,
                                                &this_module_native_info, 0);
 
+  // The method is defined on the prototype, bind it once for all timeouts.
+  jerry_value_t jcallback =
+      iotjs_jval_get_property(jtimer, IOTJS_MAGIC_STRING_HANDLETIMEOUT);
+  iotjs_uv_handle_set_slot(handle, IOTJS_TIMER_SLOT_HANDLETIMEOUT, jcallback);
+  jerry_release_value(jcallback);
+
   const iotjs_environment_t* env = iotjs_environment_get();
   uv_timer_init(iotjs_environment_loop(env), (uv_timer_t*)handle);
 }
@@ -33,8 +43,8 @@ static void timeout_handler(uv_timer_t* handle) {
   IOTJS_ASSERT(handle != NULL);
 
   jerry_value_t jobject = IOTJS_UV_HANDLE_DATA(handle)->jobject;
-  jerry_value_t jcallback =
-      iotjs_jval_get_property(jobject, IOTJS_MAGIC_STRING_HANDLETIMEOUT);
+  jerry_value_t jcallback = jerry_acquire_value(
+      IOTJS_UV_HANDLE_SLOT(handle, IOTJS_TIMER_SLOT_HANDLETIMEOUT));
   iotjs_invoke_callback(jcallback, jobject, NULL, 0);
   jerry_release_value(jcallback);
 }
@@ -57,14 +67,38 @@ JS_FUNCTION(timer_start) {
 
 
 JS_FUNCTION(timer_stop) {
-  JS_DECLARE_PTR(jthis, uv_handle_t, timer_handle);
-  // Stop timer.
+  JS_DECLARE_PTR(jthis, uv_timer_t, timer_handle);
+
+  // Stop timer. The handle is kept open to be started again.
+  int res = uv_timer_stop(timer_handle);
+
+  return jerry_create_number(res);
+}
+
+
+JS_FUNCTION(timer_now) {
+  JS_DECLARE_PTR(jthis, uv_timer_t, timer_handle);
+
+  return jerry_create_number((double)uv_now(timer_handle->loop));
+}
+
+
+// Queues `callback(...args)` to the immediate queue, returns its id.
+JS_FUNCTION(timer_set_immediate) {
+  DJS_CHECK_ARGS(1, function);
+
+  uint32_t id = iotjs_immediate_push(jargv[0], jargv + 1, jargc - 1);
 
-  if (!uv_is_closing(timer_handle)) {
-    iotjs_uv_handle_close(timer_handle, NULL);
-  }
+  return jerry_create_number(id);
+}
+
+
+JS_FUNCTION(timer_clear_immediate) {
+  DJS_CHECK_ARGS(1, number);
 
-  return jerry_create_number(0);
+  iotjs_immediate_clear((uint32_t)JS_GET_ARG(0, number));
+
+  return jerry_create_undefined();
 }
 
 
@@ -81,11 +115,17 @@ JS_FUNCTION(timer_constructor) {
 jerry_value_t iotjs_init_timer(void) {
   jerry_value_t timer = jerry_create_external_function(timer_constructor);
 
+  iotjs_jval_set_method(timer, IOTJS_MAGIC_STRING_SETIMMEDIATE,
+                        timer_set_immediate);
+  iotjs_jval_set_method(timer, IOTJS_MAGIC_STRING_CLEARIMMEDIATE,
+                        timer_clear_immediate);
+
   jerry_value_t prototype = jerry_create_object();
   iotjs_jval_set_property_jval(timer, IOTJS_MAGIC_STRING_PROTOTYPE, prototype);
 
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_START, timer_start);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_STOP, timer_stop);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_NOW, timer_now);
 
   jerry_release_value(prototype);
 
@@ -33,7 +33,7 @@ void iotjs_uart_object_destroy(uv_handle_t* handle) {
   iotjs_uart_t* uart = (iotjs_uart_t*)IOTJS_UV_HANDLE_EXTRA_DATA(handle);
 
   iotjs_uart_destroy_platform_data(uart->platform_data);
-  IOTJS_RELEASE(handle);
+  iotjs_uv_handle_free(handle);
 }
 
 
@@ -58,6 +58,11 @@ static void uart_worker(uv_work_t* work_req) {
   }
 }
 
+// Slot of the handle caching the `emit` method.
+#define IOTJS_UART_SLOT_EMIT 0
+
+IOTJS_UV_HANDLE_SLOT_ACCESSORS(uart_emit, IOTJS_UART_SLOT_EMIT)
+
 static void iotjs_uart_read_cb(uv_poll_t* req, int status, int events) {
   iotjs_uart_t* uart = (iotjs_uart_t*)req->data;
   char buf[UART_WRITE_BUFFER_SIZE];
@@ -67,24 +72,22 @@ static void iotjs_uart_read_cb(uv_poll_t* req, int status, int events) {
     DDDLOG("%s - read length: %d", __func__, i);
     jerry_value_t juart = IOTJS_UV_HANDLE_DATA(req)->jobject;
     jerry_value_t jemit =
-        iotjs_jval_get_property(juart, IOTJS_MAGIC_STRING_EMIT);
-    IOTJS_ASSERT(jerry_value_is_function(jemit));
-
-    jerry_value_t str =
-        jerry_create_string((const jerry_char_t*)IOTJS_MAGIC_STRING_DATA);
+        jerry_acquire_value(IOTJS_UV_HANDLE_SLOT(req, IOTJS_UART_SLOT_EMIT));
+    if (!jerry_value_is_function(jemit)) {
+      jerry_release_value(jemit);
+      return;
+    }
 
     jerry_value_t jbuf = iotjs_bufferwrap_create_buffer((size_t)i);
     iotjs_bufferwrap_t* buf_wrap = iotjs_bufferwrap_from_jbuffer(jbuf);
     iotjs_bufferwrap_copy(buf_wrap, buf, (size_t)i);
 
-    jerry_value_t jargs[] = { str, jbuf };
+    jerry_value_t jargs[] = { IOTJS_KEY(DATA), jbuf };
     jerry_value_t jres =
-        jerry_call_function(jemit, IOTJS_UV_HANDLE_DATA(req)->jobject, jargs,
-                            2);
+        jerry_call_function(jemit, juart, jargs, 2);
     IOTJS_ASSERT(!jerry_value_is_error(jres));
 
     jerry_release_value(jres);
-    jerry_release_value(str);
     jerry_release_value(jbuf);
     jerry_release_value(jemit);
   }
@@ -158,6 +161,16 @@ JS_FUNCTION(uart_constructor) {
                              sizeof(iotjs_uart_t));
   iotjs_uart_t* uart =
       (iotjs_uart_t*)IOTJS_UV_HANDLE_EXTRA_DATA(uart_poll_handle);
+
+  // `emit` is mixed into the prototype. The instance gets an accessor
+  // backed by the slot, seeded with the inherited method, so that reads use
+  // the cached function and reassignments replace it.
+  jerry_value_t jemit = iotjs_jval_get_property(juart, IOTJS_MAGIC_STRING_EMIT);
+  iotjs_uv_handle_set_slot(uart_poll_handle, IOTJS_UART_SLOT_EMIT, jemit);
+  jerry_release_value(jemit);
+  iotjs_jval_set_accessor(juart, IOTJS_MAGIC_STRING_EMIT, uart_emit_get,
+                          uart_emit_set);
+
   // TODO: merge platform data allocation into the handle allocation.
   iotjs_uart_create_platform_data(uart);
   uart->device_fd = -1;
@@ -13,20 +13,79 @@
  * limitations under the License.
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+// Needed for sendmmsg().
+#define _GNU_SOURCE
+#endif
+
 #include "iotjs_def.h"
 
 #include "iotjs_module_buffer.h"
 #include "iotjs_module_tcp.h"
+#include "iotjs_tick.h"
 #include "iotjs_uv_handle.h"
 #include "iotjs_uv_request.h"
 
+#if defined(__linux__)
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#endif
+
 
 static const jerry_object_native_info_t this_module_native_info = { NULL };
 
+// Slots of the handle caching the `onmessage` and `onmessages` properties.
+#define IOTJS_UDP_SLOT_ONMESSAGE 0
+#define IOTJS_UDP_SLOT_ONMESSAGES 1
+
+IOTJS_UV_HANDLE_SLOT_ACCESSORS(udp_onmessage, IOTJS_UDP_SLOT_ONMESSAGE)
+IOTJS_UV_HANDLE_SLOT_ACCESSORS(udp_onmessages, IOTJS_UDP_SLOT_ONMESSAGES)
+
+
+// Datagrams are received one after the other into a Buffer of this size,
+// shared by consecutive batches until its room is less than one datagram of
+// the largest size. It holds at least two of them.
+#define IOTJS_UDP_BATCH_BYTES (2 * (IOTJS_MAX_READ_BUFFER_SIZE + 1))
+// Bytes describing the sender of a datagram: IPv4 address and port.
+#define IOTJS_UDP_BATCH_ADDRESS_SIZE 6
+
+/**
+ * In batch mode the received datagrams are collected into a single Buffer
+ * and passed to `onmessages` together: when libuv has read all pending
+ * datagrams, when the batch is full, and otherwise at the end of the I/O
+ * phase of the loop iteration.
+ */
+typedef struct iotjs_udp_batch_s {
+  uv_udp_t* handle;
+  // Buffer receiving the datagrams. The batch takes the bytes from `start`
+  // to `used`, the ones before are in the slices of the earlier batches.
+  jerry_value_t jbuffer;
+  iotjs_bufferwrap_t* buffer_wrap;
+  size_t start;
+  size_t used;
+  uint32_t count;
+  uint32_t max_count;
+  // Next batch waiting for the flush at the end of the I/O phase.
+  struct iotjs_udp_batch_s* next_queued;
+  bool queued;
+  // Start offset of each datagram, then the senders of the datagrams.
+  uint32_t* offsets;
+  uint8_t* addresses;
+} iotjs_udp_batch_t;
+
+static iotjs_udp_batch_t* udp_batch_queue = NULL;
+
+#define IOTJS_UDP_BATCH(handle) \
+  (*(iotjs_udp_batch_t**)IOTJS_UV_HANDLE_EXTRA_DATA(handle))
+
 
 void iotjs_udp_object_init(jerry_value_t judp) {
-  uv_handle_t* handle = iotjs_uv_handle_create(sizeof(uv_udp_t), judp,
-                                               &this_module_native_info, 0);
+  uv_handle_t* handle =
+      iotjs_uv_handle_create(sizeof(uv_udp_t), judp, &this_module_native_info,
+                             sizeof(iotjs_udp_batch_t*));
+  IOTJS_UDP_BATCH(handle) = NULL;
 
   const iotjs_environment_t* env = iotjs_environment_get();
   uv_udp_init(iotjs_environment_loop(env), (uv_udp_t*)handle);
@@ -47,7 +106,8 @@ JS_FUNCTION(udp_bind) {
   JS_DECLARE_PTR(jthis, uv_udp_t, udp_handle);
   DJS_CHECK_ARGS(2, string, number);
 
-  iotjs_string_t address = JS_GET_ARG(0, string);
+  iotjs_stack_string_t address;
+  iotjs_jval_as_stack_string(jargv[0], &address);
   const int port = JS_GET_ARG(1, number);
   jerry_value_t this_obj = JS_GET_THIS();
   jerry_value_t reuse_addr =
@@ -62,33 +122,225 @@ JS_FUNCTION(udp_bind) {
 
   char addr[sizeof(sockaddr_in6)];
   int err =
-      uv_ip4_addr(iotjs_string_data(&address), port, (sockaddr_in*)(&addr));
+      uv_ip4_addr(address.data, port, (sockaddr_in*)(&addr));
 
   if (err == 0) {
     err = uv_udp_bind(udp_handle, (const sockaddr*)(&addr), flags);
   }
 
   jerry_release_value(reuse_addr);
-  iotjs_string_destroy(&address);
+  iotjs_free_stack_string(&address);
 
   return jerry_create_number(err);
 }
 
 
+static void udp_batch_unqueue(iotjs_udp_batch_t* batch) {
+  if (!batch->queued) {
+    return;
+  }
+
+  iotjs_udp_batch_t** link = &udp_batch_queue;
+  while (*link != batch) {
+    link = &(*link)->next_queued;
+  }
+  *link = batch->next_queued;
+
+  batch->next_queued = NULL;
+  batch->queued = false;
+}
+
+
+// Passes the collected datagrams to `onmessages`:
+// [0] udp handle
+// [1] Buffer holding the datagrams one after the other
+// [2] start offsets of the datagrams followed by the end of the last one
+// [3] Buffer of the senders, IOTJS_UDP_BATCH_ADDRESS_SIZE bytes each
+static void udp_batch_flush(iotjs_udp_batch_t* batch) {
+  udp_batch_unqueue(batch);
+
+  if (batch->count == 0) {
+    return;
+  }
+
+  uv_handle_t* handle = (uv_handle_t*)batch->handle;
+  uint32_t count = batch->count;
+  size_t size = batch->used - batch->start;
+
+  jerry_value_t jonmessages = jerry_acquire_value(
+      IOTJS_UV_HANDLE_SLOT(handle, IOTJS_UDP_SLOT_ONMESSAGES));
+  IOTJS_ASSERT(jerry_value_is_function(jonmessages));
+
+  jerry_value_t jargs[4];
+  jargs[0] = jerry_acquire_value(IOTJS_UV_HANDLE_DATA(handle)->jobject);
+  jargs[1] = iotjs_bufferwrap_create_buffer_slice(batch->buffer_wrap,
+                                                  batch->start, size);
+
+  jargs[2] = jerry_create_array(count + 1);
+  for (uint32_t i = 0; i < count; i++) {
+    jerry_value_t joffset = jerry_create_number(batch->offsets[i]);
+    iotjs_jval_set_property_by_index(jargs[2], i, joffset);
+    jerry_release_value(joffset);
+  }
+  jerry_value_t jend = jerry_create_number((double)size);
+  iotjs_jval_set_property_by_index(jargs[2], count, jend);
+  jerry_release_value(jend);
+
+  size_t addresses_size = count * IOTJS_UDP_BATCH_ADDRESS_SIZE;
+  jargs[3] = iotjs_bufferwrap_create_buffer_uninitialized(addresses_size);
+  iotjs_bufferwrap_copy(iotjs_bufferwrap_from_jbuffer(jargs[3]),
+                        (const char*)batch->addresses, addresses_size);
+
+  // The next batch is received into the rest of the Buffer.
+  batch->start = batch->used;
+  batch->count = 0;
+
+  iotjs_invoke_callback(jonmessages, jerry_create_undefined(), jargs, 4);
+
+  jerry_release_value(jonmessages);
+  for (int i = 0; i < 4; i++) {
+    jerry_release_value(jargs[i]);
+  }
+}
+
+
+// Flushes the batches which were not completed by the I/O callbacks of
+// the loop iteration. Queued as an immediate.
+JS_FUNCTION(udp_flush_batches) {
+  while (udp_batch_queue != NULL) {
+    udp_batch_flush(udp_batch_queue);
+  }
+
+  return jerry_create_undefined();
+}
+
+
+static void udp_batch_queue_flush(iotjs_udp_batch_t* batch) {
+  if (batch->queued) {
+    return;
+  }
+
+  if (udp_batch_queue == NULL) {
+    jerry_value_t judp = iotjs_module_get("udp");
+    jerry_value_t jflush =
+        iotjs_jval_get_property(judp, IOTJS_MAGIC_STRING__FLUSHBATCHES);
+    iotjs_immediate_push(jflush, NULL, 0);
+    jerry_release_value(jflush);
+  }
+
+  batch->next_queued = udp_batch_queue;
+  udp_batch_queue = batch;
+  batch->queued = true;
+}
+
+
+static void udp_batch_push(iotjs_udp_batch_t* batch, size_t nread,
+                           const struct sockaddr* addr) {
+  uint8_t* address =
+      batch->addresses + batch->count * IOTJS_UDP_BATCH_ADDRESS_SIZE;
+
+  if (addr != NULL && addr->sa_family == AF_INET) {
+    const sockaddr_in* addr4 = (const sockaddr_in*)addr;
+    memcpy(address, &addr4->sin_addr.s_addr, 4);
+    // Both are in network byte order already.
+    memcpy(address + 4, &addr4->sin_port, 2);
+  } else {
+    memset(address, 0, IOTJS_UDP_BATCH_ADDRESS_SIZE);
+  }
+
+  batch->offsets[batch->count++] = (uint32_t)(batch->used - batch->start);
+  batch->used += nread;
+}
+
+
+static void udp_batch_free(iotjs_udp_batch_t* batch) {
+  udp_batch_unqueue(batch);
+
+  if (batch->buffer_wrap != NULL) {
+    jerry_release_value(batch->jbuffer);
+  }
+
+  IOTJS_RELEASE(batch);
+}
+
+
+static void udp_on_close(uv_handle_t* handle) {
+  if (IOTJS_UDP_BATCH(handle) != NULL) {
+    udp_batch_free(IOTJS_UDP_BATCH(handle));
+    IOTJS_UDP_BATCH(handle) = NULL;
+  }
+}
+
+
 static void on_alloc(uv_handle_t* handle, size_t suggested_size,
                      uv_buf_t* buf) {
   if (suggested_size > IOTJS_MAX_READ_BUFFER_SIZE) {
     suggested_size = IOTJS_MAX_READ_BUFFER_SIZE;
   }
 
-  buf->base = iotjs_buffer_allocate(suggested_size);
+  iotjs_udp_batch_t* batch = IOTJS_UDP_BATCH(handle);
+
+  if (batch == NULL) {
+    buf->base = iotjs_buffer_allocate(suggested_size);
+    buf->len = suggested_size;
+    return;
+  }
+
+  // A full batch is always flushed, so only a new batch can run out of
+  // room. The slices of the flushed batches keep the old Buffer alive.
+  if (batch->buffer_wrap != NULL &&
+      IOTJS_UDP_BATCH_BYTES - batch->used < IOTJS_MAX_READ_BUFFER_SIZE) {
+    IOTJS_ASSERT(batch->count == 0);
+    jerry_release_value(batch->jbuffer);
+    batch->buffer_wrap = NULL;
+  }
+
+  // The datagram is received right after the previous ones.
+  if (batch->buffer_wrap == NULL) {
+    batch->jbuffer =
+        iotjs_bufferwrap_create_buffer_uninitialized(IOTJS_UDP_BATCH_BYTES);
+    batch->buffer_wrap = iotjs_bufferwrap_from_jbuffer(batch->jbuffer);
+    batch->start = 0;
+    batch->used = 0;
+  }
+
+  buf->base = batch->buffer_wrap->buffer + batch->used;
   buf->len = suggested_size;
 }
 
 
+static void on_recv_batch(uv_udp_t* handle, iotjs_udp_batch_t* batch,
+                          ssize_t nread, const struct sockaddr* addr) {
+  if (nread == 0 && addr == NULL) {
+    // Every pending datagram has been read.
+    udp_batch_flush(batch);
+    return;
+  }
+
+  udp_batch_push(batch, (size_t)nread, addr);
+
+  if (batch->count == batch->max_count ||
+      IOTJS_UDP_BATCH_BYTES - batch->used < IOTJS_MAX_READ_BUFFER_SIZE) {
+    udp_batch_flush(batch);
+  } else {
+    udp_batch_queue_flush(batch);
+  }
+}
+
+
 static void on_recv(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
                     const struct sockaddr* addr, unsigned int flags) {
-  if (nread == 0 && addr == NULL) {
+  iotjs_udp_batch_t* batch = IOTJS_UDP_BATCH(handle);
+
+  if (batch != NULL) {
+    if (nread >= 0) {
+      on_recv_batch(handle, batch, nread, addr);
+      return;
+    }
+
+    // Errors are reported after the datagrams received before them.
+    udp_batch_flush(batch);
+  } else if (nread == 0 && addr == NULL) {
     iotjs_buffer_release(buf->base);
     return;
   }
@@ -98,8 +350,8 @@ static void on_recv(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
   IOTJS_ASSERT(jerry_value_is_object(judp));
 
   // onmessage callback
-  jerry_value_t jonmessage =
-      iotjs_jval_get_property(judp, IOTJS_MAGIC_STRING_ONMESSAGE);
+  jerry_value_t jonmessage = jerry_acquire_value(
+      IOTJS_UV_HANDLE_SLOT(handle, IOTJS_UDP_SLOT_ONMESSAGE));
   IOTJS_ASSERT(jerry_value_is_function(jonmessage));
 
   jerry_value_t jargs[4] = { jerry_create_number(nread),
@@ -107,7 +359,9 @@ static void on_recv(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
                              jerry_create_object() };
 
   if (nread < 0) {
-    iotjs_buffer_release(buf->base);
+    if (batch == NULL) {
+      iotjs_buffer_release(buf->base);
+    }
     iotjs_invoke_callback(jonmessage, jerry_create_undefined(), jargs, 2);
     jerry_release_value(jonmessage);
 
@@ -117,7 +371,7 @@ static void on_recv(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
     return;
   }
 
-  jargs[2] = iotjs_bufferwrap_create_buffer((size_t)nread);
+  jargs[2] = iotjs_bufferwrap_create_buffer_uninitialized((size_t)nread);
   iotjs_bufferwrap_t* buffer_wrap = iotjs_bufferwrap_from_jbuffer(jargs[2]);
   iotjs_bufferwrap_copy(buffer_wrap, buf->base, (size_t)nread);
   address_to_js(jargs[3], addr);
@@ -133,9 +387,33 @@ static void on_recv(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
 }
 
 
+// Starts receiving datagrams.
+// [0] maximum number of datagrams passed to `onmessages` at once, datagrams
+//     are passed one by one to `onmessage` if it is less than 2
 JS_FUNCTION(udp_recv_start) {
   JS_DECLARE_PTR(jthis, uv_udp_t, udp_handle);
 
+  uint32_t max_count = 0;
+  if (jargc > 0 && jerry_value_is_number(jargv[0])) {
+    max_count = (uint32_t)jerry_get_number_value(jargv[0]);
+  }
+
+  uv_handle_t* handle = (uv_handle_t*)udp_handle;
+  if (max_count > 1 && IOTJS_UDP_BATCH(handle) == NULL) {
+    size_t size = sizeof(iotjs_udp_batch_t) +
+                  (size_t)max_count * sizeof(uint32_t) +
+                  (size_t)max_count * IOTJS_UDP_BATCH_ADDRESS_SIZE;
+    iotjs_udp_batch_t* batch = (iotjs_udp_batch_t*)iotjs_buffer_allocate(size);
+
+    batch->handle = udp_handle;
+    batch->max_count = max_count;
+    batch->offsets = (uint32_t*)(batch + 1);
+    batch->addresses = (uint8_t*)(batch->offsets + max_count);
+
+    IOTJS_UDP_BATCH(handle) = batch;
+    IOTJS_UV_HANDLE_DATA(handle)->on_close_cb = udp_on_close;
+  }
+
   int err = uv_udp_recv_start(udp_handle, on_alloc, on_recv);
 
   // UV_EALREADY means that the socket is already bound but that's okay
@@ -191,7 +469,8 @@ JS_FUNCTION(udp_send) {
 
   const jerry_value_t jbuffer = JS_GET_ARG(0, object);
   const unsigned short port = JS_GET_ARG(1, number);
-  iotjs_string_t address = JS_GET_ARG(2, string);
+  iotjs_stack_string_t address;
+  iotjs_jval_as_stack_string(jargv[2], &address);
   jerry_value_t jcallback = JS_GET_ARG(3, object);
 
   iotjs_bufferwrap_t* buffer_wrap = iotjs_jbuffer_get_bufferwrap_ptr(jbuffer);
@@ -211,7 +490,7 @@ JS_FUNCTION(udp_send) {
 
   char addr[sizeof(sockaddr_in6)];
   int err =
-      uv_ip4_addr(iotjs_string_data(&address), port, (sockaddr_in*)(&addr));
+      uv_ip4_addr(address.data, port, (sockaddr_in*)(&addr));
 
   if (err == 0) {
     err = uv_udp_send((uv_udp_send_t*)req_send, udp_handle, &buf, 1,
@@ -222,7 +501,348 @@ JS_FUNCTION(udp_send) {
     iotjs_uv_request_destroy(req_send);
   }
 
-  iotjs_string_destroy(&address);
+  iotjs_free_stack_string(&address);
+
+  return jerry_create_number(err);
+}
+
+
+// Largest number of datagrams of a sendBatch() call.
+#define IOTJS_UDP_SEND_BATCH_MAX 1024
+
+// A datagram of a sendBatch() call that is sent through uv_udp_send().
+typedef struct {
+  uv_udp_send_t req;
+  size_t length;
+} iotjs_udp_batch_send_t;
+
+// State of a sendBatch() call, stored in the extra data of its request.
+typedef struct {
+  // Keeps the buffers of the datagrams alive until they are sent.
+  jerry_value_t jbuffers;
+  uint32_t pending;
+  int status;
+  size_t sent_bytes;
+  iotjs_udp_batch_send_t sends[];
+} iotjs_udp_send_batch_t;
+
+#define IOTJS_UDP_SEND_BATCH(req)                                \
+  ((iotjs_udp_send_batch_t*)IOTJS_ALIGNUP(                       \
+      (uintptr_t)IOTJS_UV_REQUEST_EXTRA_DATA((uv_req_t*)(req)), 8u))
+
+
+#if defined(__linux__)
+// Datagrams passed to one sendmmsg() call.
+#define IOTJS_UDP_SENDMMSG_CHUNK 64
+// Limits of the kernel for a datagram segmented by UDP_SEGMENT.
+#define IOTJS_UDP_GSO_MAX_SEGMENTS 64
+#define IOTJS_UDP_GSO_MAX_BYTES (65535 - 8 - 20)
+
+// Set once the kernel or the device turned out not to support UDP_SEGMENT.
+static bool udp_gso_disabled = false;
+
+
+// Returns the segment size if the datagrams can be passed to the kernel
+// as one UDP_SEGMENT send: same destination, same size, except for the
+// last one, which may be shorter. Returns 0 otherwise.
+static size_t udp_gso_segment_size(const uv_buf_t* bufs,
+                                   const sockaddr_in* addrs, uint32_t count) {
+#if defined(UDP_SEGMENT)
+  if (udp_gso_disabled || count < 2 || count > IOTJS_UDP_GSO_MAX_SEGMENTS) {
+    return 0;
+  }
+
+  size_t segment_size = bufs[0].len;
+  size_t total = 0;
+
+  if (segment_size == 0) {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    if (bufs[i].len > segment_size ||
+        (bufs[i].len < segment_size && i != count - 1) || bufs[i].len == 0 ||
+        addrs[i].sin_port != addrs[0].sin_port ||
+        addrs[i].sin_addr.s_addr != addrs[0].sin_addr.s_addr) {
+      return 0;
+    }
+    total += bufs[i].len;
+  }
+
+  return total <= IOTJS_UDP_GSO_MAX_BYTES ? segment_size : 0;
+#else
+  return 0;
+#endif
+}
+
+
+// Sends the datagrams with one sendmsg() call segmented by the kernel.
+// Returns the number of datagrams sent.
+static uint32_t udp_send_gso(int fd, const uv_buf_t* bufs,
+                             const sockaddr_in* addrs, uint32_t count,
+                             size_t segment_size, size_t* sent_bytes) {
+#if defined(UDP_SEGMENT)
+  char control[CMSG_SPACE(sizeof(uint16_t))];
+  memset(control, 0, sizeof(control));
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_name = (void*)&addrs[0];
+  msg.msg_namelen = sizeof(sockaddr_in);
+  // uv_buf_t has the layout of struct iovec on unix platforms.
+  msg.msg_iov = (struct iovec*)bufs;
+  msg.msg_iovlen = count;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_UDP;
+  cmsg->cmsg_type = UDP_SEGMENT;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+  uint16_t gso_size = (uint16_t)segment_size;
+  memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+  ssize_t res;
+  do {
+    res = sendmsg(fd, &msg, 0);
+  } while (res < 0 && errno == EINTR);
+
+  if (res >= 0) {
+    *sent_bytes += (size_t)res;
+    return count;
+  }
+
+  if (errno == EIO || errno == ENOPROTOOPT || errno == EOPNOTSUPP) {
+    // Not supported by the kernel or the device, sendmmsg() is used
+    // from now on.
+    udp_gso_disabled = true;
+  }
+  // Other errors, like EINVAL for a segment larger than the MTU of the
+  // route, only make this batch fall back to sendmmsg().
+#endif
+  return 0;
+}
+
+
+// Sends as many datagrams as the socket accepts without blocking, first
+// with UDP_SEGMENT, otherwise with sendmmsg(). Returns the number of
+// datagrams sent. Errors other than EAGAIN are stored in `status`.
+static uint32_t udp_send_direct(uv_udp_t* handle, const uv_buf_t* bufs,
+                                const sockaddr_in* addrs, uint32_t count,
+                                size_t* sent_bytes, int* status) {
+  uv_os_fd_t fd;
+  if (uv_fileno((uv_handle_t*)handle, &fd) != 0) {
+    return 0;
+  }
+
+  size_t segment_size = udp_gso_segment_size(bufs, addrs, count);
+  if (segment_size > 0 &&
+      udp_send_gso(fd, bufs, addrs, count, segment_size, sent_bytes) > 0) {
+    return count;
+  }
+
+  struct mmsghdr msgs[IOTJS_UDP_SENDMMSG_CHUNK];
+  uint32_t sent = 0;
+
+  while (sent < count) {
+    uint32_t chunk = count - sent;
+    if (chunk > IOTJS_UDP_SENDMMSG_CHUNK) {
+      chunk = IOTJS_UDP_SENDMMSG_CHUNK;
+    }
+
+    memset(msgs, 0, chunk * sizeof(struct mmsghdr));
+    for (uint32_t i = 0; i < chunk; i++) {
+      struct msghdr* msg = &msgs[i].msg_hdr;
+      msg->msg_name = (void*)&addrs[sent + i];
+      msg->msg_namelen = sizeof(sockaddr_in);
+      msg->msg_iov = (struct iovec*)&bufs[sent + i];
+      msg->msg_iovlen = 1;
+    }
+
+    int res = sendmmsg(fd, msgs, chunk, 0);
+    if (res < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        *status = -errno;
+      }
+      break;
+    }
+
+    for (int i = 0; i < res; i++) {
+      *sent_bytes += msgs[i].msg_len;
+    }
+    sent += (uint32_t)res;
+
+    if ((uint32_t)res < chunk) {
+      // The socket buffer is full.
+      break;
+    }
+  }
+
+  return sent;
+}
+#endif /* __linux__ */
+
+
+static void udp_send_batch_complete(uv_req_t* req) {
+  iotjs_udp_send_batch_t* batch = IOTJS_UDP_SEND_BATCH(req);
+  jerry_value_t jargs[2] = { jerry_create_number(batch->status),
+                             jerry_create_number((double)batch->sent_bytes) };
+
+  iotjs_invoke_callback(*IOTJS_UV_REQUEST_JSCALLBACK(req),
+                        jerry_create_undefined(), jargs, 2);
+
+  jerry_release_value(jargs[0]);
+  jerry_release_value(jargs[1]);
+  jerry_release_value(batch->jbuffers);
+  iotjs_uv_request_destroy(req);
+}
+
+
+static void on_send_batch(uv_udp_send_t* send_req, int status) {
+  uv_req_t* req = (uv_req_t*)send_req->data;
+  iotjs_udp_send_batch_t* batch = IOTJS_UDP_SEND_BATCH(req);
+
+  if (status < 0) {
+    if (batch->status == 0) {
+      batch->status = status;
+    }
+  } else {
+    batch->sent_bytes += ((iotjs_udp_batch_send_t*)send_req)->length;
+  }
+
+  if (--batch->pending == 0) {
+    udp_send_batch_complete(req);
+  }
+}
+
+
+// Queues the datagrams the socket did not accept right away. Returns the
+// error of the first datagram if none of them could be queued.
+static int udp_send_batch_queue(uv_udp_t* udp_handle, jerry_value_t jbuffers,
+                                jerry_value_t jcallback, const uv_buf_t* bufs,
+                                const sockaddr_in* addrs, uint32_t count,
+                                size_t sent_bytes) {
+  size_t extra_size = 8 + sizeof(iotjs_udp_send_batch_t) +
+                      count * sizeof(iotjs_udp_batch_send_t);
+  uv_req_t* req =
+      iotjs_uv_request_create(sizeof(uv_req_t), jcallback, extra_size);
+  iotjs_udp_send_batch_t* batch = IOTJS_UDP_SEND_BATCH(req);
+
+  batch->sent_bytes = sent_bytes;
+
+  for (uint32_t i = 0; i < count; i++) {
+    iotjs_udp_batch_send_t* send = &batch->sends[i];
+    send->req.data = req;
+    send->length = bufs[i].len;
+
+    int err = uv_udp_send(&send->req, udp_handle, &bufs[i], 1,
+                          (const sockaddr*)&addrs[i], on_send_batch);
+    if (err) {
+      batch->status = err;
+      break;
+    }
+    batch->pending++;
+  }
+
+  if (batch->pending == 0) {
+    int err = batch->status;
+    iotjs_uv_request_destroy(req);
+    return err;
+  }
+
+  batch->jbuffers = jerry_acquire_value(jbuffers);
+  return 0;
+}
+
+
+// Send a batch of messages with a single completion callback.
+// [0] buffers
+// [1] ports
+// [2] ips
+// [3] callback function
+JS_FUNCTION(udp_send_batch) {
+  JS_DECLARE_PTR(jthis, uv_udp_t, udp_handle);
+  DJS_CHECK_ARGS(4, array, array, array, function);
+
+  jerry_value_t jbuffers = JS_GET_ARG(0, array);
+  jerry_value_t jports = JS_GET_ARG(1, array);
+  jerry_value_t jips = JS_GET_ARG(2, array);
+  jerry_value_t jcallback = JS_GET_ARG(3, function);
+
+  uint32_t count = jerry_get_array_length(jbuffers);
+  if (count == 0 || count > IOTJS_UDP_SEND_BATCH_MAX ||
+      jerry_get_array_length(jports) != count ||
+      jerry_get_array_length(jips) != count) {
+    return JS_CREATE_ERROR(RANGE, "Invalid batch size");
+  }
+
+  uv_buf_t* bufs = IOTJS_CALLOC(count, uv_buf_t);
+  sockaddr_in* addrs = IOTJS_CALLOC(count, sockaddr_in);
+  int err = 0;
+
+  for (uint32_t i = 0; i < count && err == 0; i++) {
+    jerry_value_t jbuffer = iotjs_jval_get_property_by_index(jbuffers, i);
+    jerry_value_t jport = iotjs_jval_get_property_by_index(jports, i);
+    jerry_value_t jip = iotjs_jval_get_property_by_index(jips, i);
+
+    iotjs_bufferwrap_t* buffer_wrap = iotjs_jbuffer_get_bufferwrap_ptr(jbuffer);
+    if (buffer_wrap == NULL || !jerry_value_is_number(jport) ||
+        !jerry_value_is_string(jip)) {
+      err = UV_EINVAL;
+    } else {
+      bufs[i].base = buffer_wrap->buffer;
+      bufs[i].len = iotjs_bufferwrap_length(buffer_wrap);
+
+      iotjs_stack_string_t ip;
+      iotjs_jval_as_stack_string(jip, &ip);
+      err = uv_ip4_addr(ip.data, (int)jerry_get_number_value(jport),
+                        &addrs[i]);
+      iotjs_free_stack_string(&ip);
+    }
+
+    jerry_release_value(jbuffer);
+    jerry_release_value(jport);
+    jerry_release_value(jip);
+  }
+
+  if (err == 0) {
+    uint32_t sent = 0;
+    size_t sent_bytes = 0;
+    int status = 0;
+    bool queued = false;
+
+#if defined(__linux__)
+    // Datagrams queued by libuv go out first, to keep the order.
+    if (udp_handle->send_queue_count == 0) {
+      sent = udp_send_direct(udp_handle, bufs, addrs, count, &sent_bytes,
+                             &status);
+    }
+#endif
+
+    if (status == 0 && sent < count) {
+      status = udp_send_batch_queue(udp_handle, jbuffers, jcallback,
+                                    bufs + sent, addrs + sent, count - sent,
+                                    sent_bytes);
+      queued = (status == 0);
+    }
+
+    if (status != 0 && sent == 0) {
+      err = status;
+    } else if (!queued) {
+      // Completed right away, the callback is still called asynchronously.
+      jerry_value_t jargs[2] = { jerry_create_number(status),
+                                 jerry_create_number((double)sent_bytes) };
+      iotjs_tick_push(jcallback, jargs, 2);
+      jerry_release_value(jargs[0]);
+      jerry_release_value(jargs[1]);
+    }
+  }
+
+  IOTJS_RELEASE(bufs);
+  IOTJS_RELEASE(addrs);
 
   return jerry_create_number(err);
 }
@@ -232,7 +852,15 @@ JS_FUNCTION(udp_send) {
 JS_FUNCTION(udp_close) {
   JS_DECLARE_PTR(jthis, uv_handle_t, uv_handle);
 
-  iotjs_uv_handle_close(uv_handle, NULL);
+  // The datagrams of a pending batch are not delivered after the close.
+  iotjs_udp_batch_t* batch = IOTJS_UDP_BATCH(uv_handle);
+  if (batch != NULL) {
+    udp_batch_unqueue(batch);
+    batch->start = batch->used;
+    batch->count = 0;
+  }
+
+  iotjs_uv_handle_close(uv_handle, udp_on_close);
 
   return jerry_create_undefined();
 }
@@ -305,7 +933,8 @@ static jerry_value_t set_membership(const jerry_value_t jthis,
   JS_DECLARE_PTR(jthis, uv_udp_t, udp_handle);
   DJS_CHECK_ARGS(1, string);
 
-  iotjs_string_t address = JS_GET_ARG(0, string);
+  iotjs_stack_string_t address;
+  iotjs_jval_as_stack_string(jargv[0], &address);
   bool is_undefined_or_null =
       jerry_value_is_undefined(jargv[1]) || jerry_value_is_null(jargv[1]);
   iotjs_string_t iface;
@@ -318,13 +947,13 @@ static jerry_value_t set_membership(const jerry_value_t jthis,
     iface_cstr = iotjs_string_data(&iface);
   }
 
-  int err = uv_udp_set_membership(udp_handle, iotjs_string_data(&address),
+  int err = uv_udp_set_membership(udp_handle, address.data,
                                   iface_cstr, membership);
 
   if (!is_undefined_or_null)
     iotjs_string_destroy(&iface);
 
-  iotjs_string_destroy(&address);
+  iotjs_free_stack_string(&address);
   return jerry_create_number(err);
 #else
   IOTJS_ASSERT(!"Not implemented");
@@ -364,11 +993,18 @@ jerry_value_t iotjs_init_udp(void) {
   jerry_value_t prototype = jerry_create_object();
   iotjs_jval_set_property_jval(udp, IOTJS_MAGIC_STRING_PROTOTYPE, prototype);
 
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONMESSAGE,
+                          udp_onmessage_get, udp_onmessage_set);
+  iotjs_jval_set_accessor(prototype, IOTJS_MAGIC_STRING_ONMESSAGES,
+                          udp_onmessages_get, udp_onmessages_set);
+
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_BIND, udp_bind);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_RECVSTART,
                         udp_recv_start);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_RECVSTOP, udp_recv_stop);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_SEND, udp_send);
+  iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_SENDBATCH,
+                        udp_send_batch);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_CLOSE, udp_close);
   iotjs_jval_set_method(prototype, IOTJS_MAGIC_STRING_GETSOCKNAME,
                         udp_get_socket_name);
@@ -382,5 +1018,8 @@ jerry_value_t iotjs_init_udp(void) {
 
   jerry_release_value(prototype);
 
+  iotjs_jval_set_method(udp, IOTJS_MAGIC_STRING__FLUSHBATCHES,
+                        udp_flush_batches);
+
   return udp;
 }
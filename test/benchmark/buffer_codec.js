@@ -0,0 +1,60 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures hex and base64 conversion throughput of Buffer.
+ *
+ *   iotjs buffer_codec.js [size in bytes] [iterations]
+ *
+ * To compare against the scalar conversion code, run it with a build
+ * configured with --compile-flag=-DIOTJS_BUFFER_NO_SIMD.
+ */
+
+var size = parseInt(process.argv[2]) || 64 * 1024;
+var iterations = parseInt(process.argv[3]) || 200;
+
+var data = new Buffer(size);
+for (var i = 0; i < size; i++) {
+  data[i] = (i * 7919 + 13) & 0xff;
+}
+
+var hex = data.toString('hex');
+var base64 = data.toString('base64');
+
+function measure(name, fn) {
+  var start = Date.now();
+  for (var i = 0; i < iterations; i++) {
+    fn();
+  }
+  var elapsed = Math.max(Date.now() - start, 1);
+  var mbps = (size * iterations / (1024 * 1024)) / (elapsed / 1000);
+
+  console.log(name + ': ' + mbps.toFixed(1) + ' MB/s');
+}
+
+console.log('buffer size: ' + size + ', iterations: ' + iterations);
+
+measure('hex encode', function() {
+  data.toString('hex');
+});
+measure('hex decode', function() {
+  new Buffer(hex, 'hex');
+});
+measure('base64 encode', function() {
+  data.toString('base64');
+});
+measure('base64 decode', function() {
+  new Buffer(base64, 'base64');
+});
@@ -0,0 +1,120 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures how fast datagrams are sent over the loopback interface with
+ * socket.send() and with socket.sendBatch().
+ *
+ *   iotjs dgram_send_batch.js [datagram size] [datagram count] [batch size]
+ *
+ * Every mode sends the same number of datagrams and waits for the send
+ * callbacks before the next batch, so the receiver is not flooded.
+ */
+
+var dgram = require('dgram');
+
+var size = parseInt(process.argv[2]) || 512;
+var count = parseInt(process.argv[3]) || 20000;
+var batchSize = parseInt(process.argv[4]) || 32;
+count = Math.ceil(count / batchSize) * batchSize;
+var port = 41250;
+
+var payload = new Buffer(size);
+payload.fill(0x61);
+
+var receiver = dgram.createSocket({ type: 'udp4', recvBatchSize: 64 });
+var sender = dgram.createSocket('udp4');
+var received = 0;
+
+receiver.on('messages', function(batch) {
+  received += batch.length;
+});
+
+// Waits for the last datagrams to arrive before printing the results.
+function report(name, start, next) {
+  var elapsed = Math.max(Date.now() - start, 1);
+
+  setTimeout(function() {
+    var rate = count / (elapsed / 1000);
+
+    console.log(name + ': ' + rate.toFixed(0) + ' datagrams/s sent, ' +
+                received + ' of ' + count + ' received');
+    next();
+  }, 100);
+}
+
+function runSend(next) {
+  var sent = 0;
+  var start = Date.now();
+  received = 0;
+
+  function sendRound() {
+    var pending = batchSize;
+    for (var i = 0; i < batchSize; i++) {
+      sender.send(payload, port, '127.0.0.1', function() {
+        if (--pending > 0)
+          return;
+
+        sent += batchSize;
+        if (sent < count) {
+          sendRound();
+        } else {
+          report('send', start, next);
+        }
+      });
+    }
+  }
+
+  sendRound();
+}
+
+function runSendBatch(next) {
+  var messages = [];
+  for (var i = 0; i < batchSize; i++) {
+    messages.push({ buf: payload, port: port, address: '127.0.0.1' });
+  }
+
+  var sent = 0;
+  var start = Date.now();
+  received = 0;
+
+  function sendRound() {
+    sender.sendBatch(messages, function(err) {
+      if (err)
+        throw err;
+
+      sent += batchSize;
+      if (sent < count) {
+        sendRound();
+      } else {
+        report('sendBatch', start, next);
+      }
+    });
+  }
+
+  sendRound();
+}
+
+receiver.bind(port, function() {
+  console.log('datagram size: ' + size + ', count: ' + count +
+              ', batch size: ' + batchSize);
+
+  runSend(function() {
+    runSendBatch(function() {
+      sender.close();
+      receiver.close();
+    });
+  });
+});
@@ -39,6 +39,13 @@ buff2.write("fgh", 5);
 assert.equal(buff2.toString(), "abcdefgh");
 assert.equal(buff2.length ,10);
 
+// Strings longer than the free space are truncated.
+var buff2_tail = new Buffer(4);
+assert.equal(buff2_tail.write("\u00e9t\u00e9", 1), 3);
+assert.equal(buff2_tail.slice(1, 3).toString(), "\u00e9");
+assert.equal(buff2_tail.write("\u00e9t\u00e9"), 4);
+assert.equal(buff2_tail.slice(0, 3).toString(), "\u00e9t");
+
 assert.throws(function() { buff2.write("ijk", -1); }, RangeError);
 assert.throws(function() { buff2.write("ijk", 10); }, RangeError);
 
@@ -46,6 +53,14 @@ var buff3 = Buffer.concat([buff1, buff2]);
 assert.equal(buff3.toString(), "testabcdefgh");
 assert.equal(buff3.length ,14);
 
+var buff3_cut = Buffer.concat([buff1, buff2], 6);
+assert.equal(buff3_cut.length, 6);
+assert.equal(buff3_cut.toString(), 'testab');
+var buff3_padded = Buffer.concat([buff1, buff1.slice(1, 3)], 9);
+assert.equal(buff3_padded.toString('hex'), '746573746573000000');
+assert.equal(Buffer.concat([]).length, 0);
+assert.equal(Buffer.concat([buff1, buff2], 0).length, 0);
+
 var buff4 = new Buffer(10);
 var buff5 = new Buffer('a1b2c3');
 buff5.copy(buff4);
@@ -59,6 +74,8 @@ assert.throws(function() { buff5.compare(null); }, TypeError);
 assert.throws(function() { buff5.equals(null); }, TypeError);
 assert.throws(function() { Buffer.concat([buff1, null]);}, TypeError);
 assert.throws(function() {Buffer.concat(null, null); }, TypeError);
+assert.throws(function() { Buffer.concat([buff1], '4'); }, TypeError);
+assert.throws(function() { Buffer.concat([buff1, {}], 2); }, TypeError);
 assert.throws(function() {var buff_err = new Buffer(null); }, TypeError);
 
 var buffer_err = new Buffer(-1);
@@ -115,6 +132,18 @@ assert.equal(buff9.slice(-2).toString(), 'cd');
 assert.equal(buff9.slice(-3, -2).toString(), 'b');
 assert.equal(buff9.slice(0, -2).toString(), 'abcabcab');
 
+// Slices share the memory of the original buffer.
+var buff13 = new Buffer('abcdef');
+var buff14 = buff13.slice(1, 5);
+var buff15 = buff14.slice(1, 3);
+buff14.writeUInt8(0x42, 0);
+buff15.writeUInt8(0x43, 1);
+assert.equal(buff13.toString(), 'aBcCef');
+assert.equal(buff14.toString(), 'BcCe');
+assert.equal(buff15.toString(), 'cC');
+buff13 = null;
+assert.equal(buff15.toString(), 'cC');
+
 
 assert.equal(Buffer.isBuffer(buff9), true);
 assert.equal(Buffer.isBuffer(1), false);
@@ -175,5 +204,32 @@ assert.equal(Buffer(new Array()).toString(), '');
 assert.equal(new Buffer(1).readUInt8(1, true), 0);
 assert.equal(new Buffer(1).readUInt16LE({}, true), 0);
 
+var buff18 = new Buffer(10);
+buff18.fill('abc');
+assert.equal(buff18.toString(), 'abcabcabca');
+buff18.fill(new Buffer('xy'), 2, 7);
+assert.equal(buff18.toString(), 'abxyxyxbca');
+buff18.fill(0x2e, 8);
+assert.equal(buff18.toString(), 'abxyxyxb..');
+buff18.fill('-', 1, 3);
+assert.equal(buff18.toString(), 'a--yxyxb..');
+buff18.fill(buff18.slice(0, 3), 3);
+assert.equal(buff18.toString(), 'a--a--a--a');
+buff18.fill('z', 5, 2);
+assert.equal(buff18.toString(), 'a--a--a--a');
+
+var buff19 = Buffer.allocUnsafe(10);
+assert.equal(buff19.length, 10);
+assert.equal(Buffer.isBuffer(buff19), true);
+buff19.fill(0x41);
+assert.equal(buff19.toString(), 'AAAAAAAAAA');
+assert.equal(Buffer.allocUnsafe(-1).length, 0);
+assert.throws(function() { Buffer.allocUnsafe('10'); }, TypeError);
+
+var stats = Buffer.poolStats();
+assert.equal(stats.classes.length > 0, true);
+assert.equal(stats.classes[0].live > 0, true);
+assert.equal(stats.pooledBytes <= stats.maxPooledBytes, true);
+
 var buff17 = new Buffer("a");
 assert.throws(function() { buff17.fill(8071).toString(); }, TypeError);
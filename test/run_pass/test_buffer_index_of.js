@@ -0,0 +1,85 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+
+var buff = new Buffer('AT+CSQ\r\n+CSQ: 21,0\r\n\r\nOK\r\n');
+
+/* Single byte needles. */
+assert.equal(buff.indexOf(0x2b), 2);
+assert.equal(buff.indexOf(0x2b, 3), 8);
+assert.equal(buff.indexOf(0x2b + 256), 2);
+assert.equal(buff.indexOf('K'), 23);
+assert.equal(buff.indexOf(0x7f), -1);
+assert.equal(buff.lastIndexOf(0x2b), 8);
+assert.equal(buff.lastIndexOf('A'), 0);
+assert.equal(buff.lastIndexOf(0x2b, 7), 2);
+
+/* String and Buffer needles. */
+assert.equal(buff.indexOf('\r\n'), 6);
+assert.equal(buff.indexOf('\r\n', 7), 18);
+assert.equal(buff.indexOf('\r\n\r\n'), 18);
+assert.equal(buff.indexOf(new Buffer('+CSQ')), 2);
+assert.equal(buff.indexOf(new Buffer('+CSQ'), 3), 8);
+assert.equal(buff.indexOf('+CSQ: 22'), -1);
+assert.equal(buff.lastIndexOf('\r\n'), 24);
+assert.equal(buff.lastIndexOf('\r\n', 23), 20);
+assert.equal(buff.lastIndexOf(new Buffer('CSQ')), 9);
+assert.equal(buff.lastIndexOf('AT+', 0), 0);
+assert.equal(buff.lastIndexOf('T+', 0), -1);
+
+/* Offsets counting from the end and out of range offsets. */
+assert.equal(buff.indexOf('\r\n', -4), 24);
+assert.equal(buff.indexOf('A', -100), 0);
+assert.equal(buff.indexOf('A', 100), -1);
+assert.equal(buff.lastIndexOf('\r\n', -5), 20);
+assert.equal(buff.lastIndexOf('A', -100), -1);
+assert.equal(buff.lastIndexOf('OK', 100), 22);
+
+/* Empty needles are found at the start position. */
+assert.equal(buff.indexOf(''), 0);
+assert.equal(buff.indexOf('', 5), 5);
+assert.equal(buff.indexOf(new Buffer(0), 100), buff.length);
+assert.equal(buff.lastIndexOf(''), buff.length);
+
+/* Encodings. */
+assert.equal(buff.indexOf('0d0a', 'hex'), 6);
+assert.equal(buff.indexOf('0d0a', 7, 'hex'), 18);
+assert.equal(buff.lastIndexOf('T0s=', 'base64'), 22);
+
+/* Needles longer than the buffer and longer than the shift table. */
+assert.equal(new Buffer('abc').indexOf('abcd'), -1);
+assert.equal(new Buffer('abc').lastIndexOf('abcd'), -1);
+assert.equal(new Buffer(0).indexOf(0), -1);
+
+var long_needle = new Buffer(300);
+long_needle.fill('xyz');
+var hay = new Buffer(1000);
+hay.fill('xy');
+long_needle.copy(hay, 600);
+assert.equal(hay.indexOf(long_needle), 600);
+assert.equal(hay.lastIndexOf(long_needle), 600);
+assert.equal(hay.indexOf(long_needle, 601), -1);
+assert.equal(hay.indexOf(long_needle.slice(0, 200), 601), 603);
+
+/* includes. */
+assert.equal(buff.includes('OK'), true);
+assert.equal(buff.includes('OK', 24), false);
+assert.equal(buff.includes(0x0a), true);
+assert.equal(buff.includes('ERROR'), false);
+
+assert.throws(function() { buff.indexOf({}); }, TypeError);
+assert.throws(function() { buff.lastIndexOf(null); }, TypeError);
+assert.throws(function() { buff.includes(); }, TypeError);
@@ -0,0 +1,74 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+
+var buff = new Buffer([0x01, 0x02, 0x03, 0x04, 0xfe, 0xff, 0x80, 0x00]);
+
+assert.equal(buff.readUInt16LE(0), 0x0201);
+assert.equal(buff.readUInt16BE(0), 0x0102);
+assert.equal(buff.readInt16LE(4), -2);
+assert.equal(buff.readInt16BE(4), -257);
+assert.equal(buff.readUInt32LE(0), 0x04030201);
+assert.equal(buff.readUInt32BE(4), 0xfeff8000);
+assert.equal(buff.readInt32LE(4), 0x0080fffe);
+assert.equal(buff.readInt32BE(4), -16809984);
+
+assert.throws(function() { buff.readUInt16LE(7); }, RangeError);
+assert.throws(function() { buff.readUInt32BE(5); }, RangeError);
+assert.throws(function() { buff.readDoubleLE(1); }, RangeError);
+
+var out = new Buffer(8);
+assert.equal(out.writeUInt16BE(0x1234, 0), 2);
+assert.equal(out.writeUInt16LE(0x1234, 2), 4);
+assert.equal(out.toString('hex', 0, 4), '12343412');
+assert.equal(out.writeInt16LE(-2, 0), 2);
+assert.equal(out.readInt16LE(0), -2);
+assert.equal(out.writeInt16BE(-32768, 0), 2);
+assert.equal(out.readInt16BE(0), -32768);
+assert.equal(out.writeUInt32BE(0xdeadbeef, 4), 8);
+assert.equal(out.toString('hex', 4), 'deadbeef');
+assert.equal(out.writeUInt32LE(0xdeadbeef, 4), 8);
+assert.equal(out.toString('hex', 4), 'efbeadde');
+assert.equal(out.writeInt32LE(-1, 0), 4);
+assert.equal(out.readUInt32LE(0), 0xffffffff);
+assert.equal(out.writeInt32BE(-2147483648, 0), 4);
+assert.equal(out.readInt32BE(0), -2147483648);
+
+assert.throws(function() { out.writeUInt16LE(0x10000, 0); }, TypeError);
+assert.throws(function() { out.writeInt16BE(-32769, 0); }, TypeError);
+assert.throws(function() { out.writeInt32LE(0x80000000, 0); }, TypeError);
+assert.throws(function() { out.writeUInt32BE(1, 6); }, RangeError);
+
+assert.equal(out.writeFloatLE(1.5, 0), 4);
+assert.equal(out.toString('hex', 0, 4), '0000c03f');
+assert.equal(out.readFloatLE(0), 1.5);
+assert.equal(out.writeFloatBE(-0.25, 4), 8);
+assert.equal(out.toString('hex', 4), 'be800000');
+assert.equal(out.readFloatBE(4), -0.25);
+
+assert.equal(out.writeDoubleLE(Math.PI, 0), 8);
+assert.equal(out.readDoubleLE(0), Math.PI);
+assert.equal(out.toString('hex'), '182d4454fb210940');
+assert.equal(out.writeDoubleBE(-1e300, 0), 8);
+assert.equal(out.readDoubleBE(0), -1e300);
+assert.throws(function() { out.writeDoubleBE(1, 1); }, RangeError);
+
+// With noAssert only the bytes inside the buffer are accessed.
+var partial = new Buffer([0x12, 0x34]);
+assert.equal(partial.readUInt16BE(1, true), 0x3400);
+assert.equal(partial.readUInt32LE(4, true), 0);
+assert.equal(partial.writeUInt32BE(0xaabbccdd, 0, true), 4);
+assert.equal(partial.toString('hex'), 'aabb');
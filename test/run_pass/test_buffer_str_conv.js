@@ -98,3 +98,40 @@ assert.equal((new Buffer('ghijklmnop')).toString('hex'),
 
 assert.equal((new Buffer('ghijklmnop')).toString('hex', 2, 8),
              '696a6b6c6d6e');
+
+
+/* Inputs long enough to go through the block kernels. */
+
+var all_bytes = new Buffer(256);
+for (var i = 0; i < 256; i++) {
+  all_bytes[i] = i;
+}
+
+var all_hex = all_bytes.toString('hex');
+assert.equal(all_hex.length, 512);
+assert.equal(all_hex.slice(0, 8), '00010203');
+assert.equal(all_hex.slice(-8), 'fcfdfeff');
+assert.equal(all_hex.slice(316, 332), '9e9fa0a1a2a3a4a5');
+assert.equal(new Buffer(all_hex, 'hex').compare(all_bytes), 0);
+assert.equal(new Buffer(all_hex.toUpperCase(), 'hex').compare(all_bytes), 0);
+
+var all_base64 = all_bytes.toString('base64');
+assert.equal(all_base64.length, 344);
+assert.equal(all_base64.slice(0, 12), 'AAECAwQFBgcI');
+assert.equal(all_base64.slice(-12), '+fr7/P3+/w==');
+assert.equal(new Buffer(all_base64, 'base64').compare(all_bytes), 0);
+
+for (var len = 40; len < 52; len++) {
+  var part = all_bytes.slice(100, 100 + len);
+  assert.equal(new Buffer(part.toString('base64'), 'base64').compare(part), 0);
+  assert.equal(new Buffer(part.toString('hex'), 'hex').compare(part), 0);
+}
+
+decodeError(all_hex.slice(0, 200) + 'g' + all_hex.slice(201), 'hex');
+decodeError(all_base64.slice(0, 100) + '*' + all_base64.slice(101), 'base64');
+decodeError(all_base64.slice(0, 100) + '=' + all_base64.slice(101), 'base64');
+
+assert.throws(function () {
+  /* Errors past the end of the destination are still reported. */
+  testWrite('xxxxxxxx', all_hex.slice(0, 300) + '0g', 0, 4, 'hex', '');
+});
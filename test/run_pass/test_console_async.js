@@ -0,0 +1,68 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+
+assert.equal(console.asyncStats().enabled, false);
+
+assert.throws(function() {
+  console.setAsync(true, { queueSize: -1 });
+}, RangeError);
+assert.throws(function() {
+  console.setAsync(true, { queueSize: 100.5 });
+}, RangeError);
+assert.throws(function() {
+  console.setAsync(true, { queueSize: Infinity });
+}, RangeError);
+assert.throws(function() {
+  console.setAsync(true, { queueSize: 1e12 });
+}, RangeError);
+assert.throws(function() {
+  console.setAsync(true, { overflow: 'wait' });
+}, TypeError);
+
+// Nothing is lost when the writers wait for room.
+console.setAsync(true, { queueSize: 64, overflow: 'block' });
+assert.equal(console.asyncStats().enabled, true);
+
+for (var i = 0; i < 100; i++) {
+  console.log('block ' + i);
+}
+console.error('a message larger than the whole queue ' +
+              'is written once the queue is empty');
+assert.equal(console.asyncStats().droppedMessages, 0);
+
+// Messages which never fit are dropped.
+var long = new Array(65).join('x');
+console.setAsync(true, { queueSize: 16 });
+console.log(long);
+console.log(long);
+console.log('short');
+
+var stats = console.asyncStats();
+assert.equal(stats.droppedMessages, 2);
+
+console.setAsync(false);
+stats = console.asyncStats();
+assert.equal(stats.enabled, false);
+assert.equal(stats.queuedBytes, 0);
+
+console.log('synchronous again');
+
+// The queued output is written out on exit.
+console.setAsync(true);
+process.on('exit', function() {
+  console.log('written on exit');
+});
@@ -0,0 +1,132 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+var dgram = require('dgram');
+
+var batchPort = 41242;
+var messagePort = 41243;
+var clientPort = 41244;
+var closePort = 41245;
+var count = 6;
+var batchSize = 4;
+
+assert.throws(function() {
+  dgram.createSocket({ type: 'udp4', recvBatchSize: 0 });
+}, RangeError);
+assert.throws(function() {
+  dgram.createSocket({ type: 'udp4', recvBatchSize: 1.5 });
+}, TypeError);
+
+// Batches are passed to the 'messages' listener.
+var batchServer = dgram.createSocket({ type: 'udp4',
+                                       recvBatchSize: batchSize });
+var batchReceived = [];
+
+batchServer.on('error', function(err) {
+  assert.fail();
+});
+
+batchServer.on('messages', function(batch) {
+  assert(batch.length >= 1 && batch.length <= batchSize);
+  assert.equal(batch.offsets.length, batch.length + 1);
+  assert.equal(batch.offsets[batch.length], batch.buffer.length);
+
+  for (var i = 0; i < batch.length; i++) {
+    var rinfo = batch.rinfo(i);
+    assert.equal(rinfo.address, '127.0.0.1');
+    assert.equal(rinfo.family, 'IPv4');
+    assert.equal(rinfo.port, clientPort);
+    assert.equal(rinfo.size, batch.message(i).length);
+    batchReceived.push(batch.message(i).toString());
+  }
+
+  if (batchReceived.length == count) {
+    batchServer.close();
+  }
+});
+
+// Without a 'messages' listener the datagrams are emitted one by one.
+var messageServer = dgram.createSocket({ type: 'udp4',
+                                         recvBatchSize: batchSize });
+var messageReceived = [];
+
+messageServer.on('error', function(err) {
+  assert.fail();
+});
+
+messageServer.on('message', function(data, rinfo) {
+  assert.equal(rinfo.size, data.length);
+  messageReceived.push(data.toString());
+
+  if (messageReceived.length == count) {
+    messageServer.close();
+  }
+});
+
+// Nothing is emitted by a socket after it is closed, even if more
+// datagrams were already received.
+var closeServer = dgram.createSocket({ type: 'udp4',
+                                       recvBatchSize: batchSize });
+var closeBatches = 0;
+
+closeServer.on('error', function(err) {
+  assert.fail();
+});
+
+closeServer.on('messages', function(batch) {
+  closeBatches++;
+  closeServer.close();
+});
+
+var client = dgram.createSocket('udp4');
+
+client.on('error', function(err) {
+  assert.fail();
+});
+
+batchServer.bind(batchPort, function() {
+  messageServer.bind(messagePort, function() {
+    closeServer.bind(closePort, function() {
+      client.bind(clientPort);
+      sendAll();
+    });
+  });
+});
+
+function sendAll() {
+  var sent = 0;
+  for (var i = 0; i < count; i++) {
+    client.send('datagram ' + i, batchPort, '127.0.0.1');
+    client.send('datagram ' + i, closePort, '127.0.0.1');
+    client.send('datagram ' + i, messagePort, '127.0.0.1', function() {
+      if (++sent == count) {
+        client.close();
+      }
+    });
+  }
+}
+
+process.on('exit', function(code) {
+  assert.equal(code, 0);
+
+  var expected = [];
+  for (var i = 0; i < count; i++) {
+    expected.push('datagram ' + i);
+  }
+  assert.deepEqual(batchReceived, expected);
+  assert.deepEqual(messageReceived, expected);
+  assert.equal(closeBatches, 1);
+});
@@ -0,0 +1,66 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+var dgram = require('dgram');
+
+var port = 41245;
+var messages = ['first', new Buffer('second'), 'third'];
+var received = [];
+var sendCallbacks = 0;
+
+var server = dgram.createSocket('udp4');
+var client = dgram.createSocket('udp4');
+
+assert.throws(function() {
+  client.sendBatch([], function() {});
+}, RangeError);
+assert.throws(function() {
+  client.sendBatch([{ buf: 1, port: port, address: '127.0.0.1' }]);
+}, TypeError);
+assert.throws(function() {
+  client.sendBatch([{ buf: 'data', port: 0, address: '127.0.0.1' }]);
+}, RangeError);
+
+server.on('error', function(err) {
+  assert.fail();
+});
+
+server.on('message', function(data, rinfo) {
+  received.push(data.toString());
+
+  if (received.length == messages.length) {
+    server.close();
+  }
+});
+
+server.bind(port, function() {
+  var batch = messages.map(function(message) {
+    return { buf: message, port: port, address: '127.0.0.1' };
+  });
+
+  client.sendBatch(batch, function(err, length) {
+    assert.equal(err, null);
+    assert.equal(length, 'first'.length + 'second'.length + 'third'.length);
+    sendCallbacks++;
+    client.close();
+  });
+});
+
+process.on('exit', function(code) {
+  assert.equal(code, 0);
+  assert.equal(sendCallbacks, 1);
+  assert.deepEqual(received, ['first', 'second', 'third']);
+});
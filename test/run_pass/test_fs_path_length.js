@@ -0,0 +1,52 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var fs = require('fs');
+var assert = require('assert');
+
+// Paths are converted into fixed size buffers when they are short enough,
+// check the lengths around these sizes.
+var dir = process.cwd() + '/resources/';
+var lengths = [63, 64, 65, 255, 256, 257];
+
+function makeName(total, suffix) {
+  var length = total - dir.length - suffix.length;
+  if (length < 1 || length > 200) {
+    return null;
+  }
+  return dir + new Array(length + 1).join('p') + suffix;
+}
+
+lengths.forEach(function(total) {
+  var file = makeName(total, '.tmp');
+  if (file === null) {
+    return;
+  }
+  assert.equal(file.length, total);
+
+  fs.writeFileSync(file, 'length ' + total);
+  assert.equal(fs.existsSync(file), true);
+  assert.equal(fs.readFileSync(file).toString(), 'length ' + total);
+
+  var renamed = makeName(total + 1, '.mv');
+  fs.renameSync(file, renamed);
+  assert.equal(fs.existsSync(file), false);
+  assert.equal(fs.statSync(renamed).size, ('length ' + total).length);
+
+  fs.unlink(renamed, function(err) {
+    assert.equal(err, null);
+    assert.equal(fs.existsSync(renamed), false);
+  });
+});
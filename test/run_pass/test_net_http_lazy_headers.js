@@ -0,0 +1,60 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+var http = require('http');
+
+var port = 3012;
+var headerCount = 14;
+var responded = false;
+
+var server = http.createServer({ lazyHeaders: true }, function(req, res) {
+  assert.equal(req.url, '/lazy');
+  assert.equal(req.headers['x-count'], String(headerCount));
+  for (var i = 0; i < headerCount; i++) {
+    assert.equal(req.headers['x-header-' + i], 'value ' + i);
+  }
+
+  res.writeHead(200, { 'Connection': 'close',
+                       'x-reply': 'lazy reply' });
+  res.end('done');
+});
+
+server.listen(port, function() {
+  var headers = { 'Connection': 'close', 'x-count': headerCount };
+  for (var i = 0; i < headerCount; i++) {
+    headers['x-header-' + i] = 'value ' + i;
+  }
+
+  http.request({
+    port: port,
+    path: '/lazy',
+    headers: headers,
+    lazyHeaders: true
+  }, function(res) {
+    assert.equal(res.statusCode, 200);
+    assert.equal(res.headers['x-reply'], 'lazy reply');
+
+    res.on('data', function() {});
+    res.on('end', function() {
+      responded = true;
+      server.close();
+    });
+  }).end();
+});
+
+process.on('exit', function() {
+  assert(responded);
+});
@@ -0,0 +1,82 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+var http = require('http');
+var net = require('net');
+
+var port = 3013;
+var body = '';
+for (var i = 0; i < 200; i++) {
+  body += 'chunk ' + i + ';';
+}
+var responded = false;
+var badRequestClosed = false;
+
+var server = http.createServer({ nativeParsing: true }, function(req, res) {
+  assert.equal(req.method, 'POST');
+  assert.equal(req.url, '/native');
+  assert.equal(req.headers['content-length'], String(body.length));
+
+  var received = '';
+  req.on('data', function(data) {
+    received += data.toString();
+  });
+  req.on('end', function() {
+    assert.equal(received, body);
+    res.writeHead(200, { 'Connection': 'close' });
+    res.end(received.toUpperCase());
+  });
+});
+
+server.listen(port, function() {
+  var req = http.request({
+    method: 'POST',
+    port: port,
+    path: '/native',
+    headers: { 'Connection': 'close', 'Content-Length': body.length },
+    nativeParsing: true
+  }, function(res) {
+    assert.equal(res.statusCode, 200);
+
+    var received = '';
+    res.on('data', function(data) {
+      received += data.toString();
+    });
+    res.on('end', function() {
+      assert.equal(received, body.toUpperCase());
+      responded = true;
+      sendBadRequest();
+    });
+  });
+  req.end(body);
+});
+
+// A parse error closes the connection.
+function sendBadRequest() {
+  var socket = net.connect(port, 'localhost', function() {
+    socket.write('NOT HTTP\r\n\r\n');
+  });
+  socket.on('data', function() {});
+  socket.on('close', function() {
+    badRequestClosed = true;
+    server.close();
+  });
+}
+
+process.on('exit', function() {
+  assert(responded);
+  assert(badRequestClosed);
+});
@@ -0,0 +1,62 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Aborts a request from its 'response' handler and starts a new one right
+ * away. The new request must not get the rest of the aborted response.
+ */
+
+var assert = require('assert');
+var http = require('http');
+
+var port = 3014;
+var aborted = false;
+var replied = false;
+
+var server = http.createServer(function(req, res) {
+  var reply = 'reply ' + req.url;
+  res.writeHead(200, { 'Connection': 'close',
+                       'Content-Length': reply.length });
+  res.end(reply);
+});
+
+server.listen(port, function() {
+  var first = http.request({ port: port, path: '/first' }, function(res) {
+    assert.equal(res.statusCode, 200);
+    first.abort();
+    aborted = true;
+
+    http.request({ port: port, path: '/second' }, function(res) {
+      var reply = '';
+
+      res.on('data', function(chunk) {
+        reply += chunk;
+      });
+      res.on('end', function() {
+        assert.equal(reply, 'reply /second');
+        replied = true;
+        server.close();
+      });
+    }).end();
+  });
+
+  first.on('error', function() {});
+  first.end();
+});
+
+process.on('exit', function() {
+  assert(aborted);
+  assert(replied);
+});
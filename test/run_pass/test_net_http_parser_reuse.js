@@ -0,0 +1,108 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Sends requests one after the other on new connections, so the parsers
+ * of the closed connections are reused. Every other request has more
+ * headers than the parser passes to JavaScript at once.
+ */
+
+var assert = require('assert');
+var http = require('http');
+
+var port = 3011;
+var count = 6;
+var responses = 0;
+
+var server = http.createServer(function(req, res) {
+  var body = '';
+
+  req.on('data', function(chunk) {
+    body += chunk;
+  });
+
+  req.on('end', function() {
+    var index = req.headers['x-index'];
+    assert.equal(req.url, '/request/' + index);
+    assert.equal(body, 'body ' + index);
+
+    var extra = 0;
+    for (var name in req.headers) {
+      if (name.indexOf('x-extra-') === 0) {
+        assert.equal(req.headers[name], index);
+        extra++;
+      }
+    }
+    assert.equal(extra, index % 2 ? 12 : 0);
+
+    var reply = 'reply ' + index;
+    res.writeHead(200, { 'Connection': 'close',
+                         'Content-Length': reply.length,
+                         'x-index': index });
+    res.end(reply);
+  });
+});
+
+function request(index) {
+  var body = 'body ' + index;
+  var headers = {
+    'Connection': 'close',
+    'Content-Length': body.length,
+    'x-index': index
+  };
+
+  if (index % 2) {
+    for (var i = 0; i < 12; i++) {
+      headers['x-extra-' + i] = index;
+    }
+  }
+
+  var req = http.request({
+    method: 'POST',
+    port: port,
+    path: '/request/' + index,
+    headers: headers
+  }, function(res) {
+    var reply = '';
+
+    assert.equal(res.statusCode, 200);
+    assert.equal(res.headers['x-index'], index);
+
+    res.on('data', function(chunk) {
+      reply += chunk;
+    });
+
+    res.on('end', function() {
+      assert.equal(reply, 'reply ' + index);
+      responses++;
+
+      if (index + 1 < count) {
+        request(index + 1);
+      } else {
+        server.close();
+      }
+    });
+  });
+
+  req.end(body);
+}
+
+server.listen(port, function() {
+  request(0);
+});
+
+process.on('exit', function() {
+  assert.equal(responses, count);
+});
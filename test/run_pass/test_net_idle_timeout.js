@@ -0,0 +1,74 @@
+/* Copyright 2015-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Many sockets share one idle timeout. Every write restarts the lazy idle
+ * timer of its socket, so the timeouts are re-armed for the remaining time
+ * over and over until the sockets go quiet.
+ */
+
+var assert = require('assert');
+var net = require('net');
+
+var port = 3015;
+var count = 40;
+var timeout = 300;
+var writes = 3;
+var timedOut = 0;
+
+var server = net.createServer(function(socket) {
+  socket.on('data', function() {});
+  socket.on('error', function() {});
+});
+
+server.listen(port, function() {
+  for (var i = 0; i < count; i++) {
+    connect(i);
+  }
+});
+
+function connect(index) {
+  var socket = net.connect(port, 'localhost');
+  var lastWrite = 0;
+  var sent = 0;
+
+  socket.setTimeout(timeout);
+
+  socket.on('connect', function() {
+    var timer = setInterval(function() {
+      socket.write('ping ' + index);
+      lastWrite = Date.now();
+
+      if (++sent == writes) {
+        clearInterval(timer);
+      }
+    }, timeout / 3 + (index % 5) * 5);
+  });
+
+  socket.on('timeout', function() {
+    assert.equal(sent, writes);
+    // Timers may fire a little early on coarse clocks.
+    assert(Date.now() - lastWrite >= timeout - 20);
+
+    socket.destroy();
+    if (++timedOut == count) {
+      server.close();
+    }
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(timedOut, count);
+});
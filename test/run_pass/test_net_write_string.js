@@ -0,0 +1,64 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var net = require('net');
+var assert = require('assert');
+
+var port = 22710;
+var received = [];
+var callbacks = 0;
+
+var server = net.createServer(function(socket) {
+  socket.on('data', function(data) {
+    received.push(data);
+  });
+  socket.on('end', function() {
+    socket.end();
+    server.close();
+  });
+});
+
+server.listen(port);
+
+function onwrite(status) {
+  assert.equal(status, 0);
+  callbacks++;
+}
+
+var socket = net.createConnection(port, function() {
+  // Single writes of strings and Buffers.
+  socket.write('plain ', onwrite);
+  socket.write('été ', onwrite);
+  socket.write(new Buffer('buffer '), onwrite);
+
+  // Corked chunks are flushed with a single vectored write.
+  socket.cork();
+  var queued = socket._writableState.length;
+  socket.write('one ', onwrite);
+  socket.write(new Buffer('two '), onwrite);
+  socket.write('한글', onwrite);
+  // The queued strings are counted in bytes.
+  assert.equal(socket._writableState.length, queued + 14);
+  socket.uncork();
+
+  socket.end();
+});
+
+process.on('exit', function() {
+  var data = Buffer.concat(received);
+  assert.equal(data.toString(), 'plain été buffer one two 한글');
+  assert.equal(data.length, 33);
+  assert.equal(callbacks, 6);
+});
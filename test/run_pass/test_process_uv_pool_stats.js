@@ -0,0 +1,65 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+var fs = require('fs');
+
+
+function sum(pool, name) {
+  var total = 0;
+  pool.classes.forEach(function(c) {
+    total += c[name];
+  });
+  return total;
+}
+
+
+var stats = process.uvPoolStats();
+
+assert(Array.isArray(stats.handles.classes));
+assert(Array.isArray(stats.requests.classes));
+assert.equal(typeof stats.pooledBytes, 'number');
+assert(stats.pooledBytes <= stats.maxPooledBytes);
+
+var liveBefore = sum(stats.requests, 'live');
+var hitsBefore = sum(stats.requests, 'hits');
+var count = 0;
+
+// The memory of a request is released after its callback returns, so the
+// next request is started from an immediate to reuse it.
+function next() {
+  fs.stat(process.cwd(), function(err) {
+    assert.equal(err, null);
+    if (++count < 4) {
+      setImmediate(next);
+    }
+  });
+}
+
+next();
+
+process.on('exit', function() {
+  assert.equal(count, 4);
+
+  var stats = process.uvPoolStats();
+  assert.equal(sum(stats.requests, 'live'), liveBefore);
+  assert(sum(stats.requests, 'hits') >= hitsBefore + 3);
+  assert(sum(stats.requests, 'pooled') > 0);
+
+  stats.requests.classes.forEach(function(c) {
+    assert(c.size > 0);
+    assert(c.hits + c.misses >= c.live);
+  });
+});
@@ -158,6 +158,45 @@ assert.throws(function() {
   readable4.push(null);
 }, Error);
 
+// push() returns false above the high water mark, read() asks for more.
+var readable5 = new Readable({ highWaterMark: 8 });
+var readCalls = 0;
+
+readable5._read = function(size) {
+  readCalls++;
+  assert.equal(size > 0, true);
+};
+
+assert.equal(readable5.push('1234'), true);
+assert.equal(readable5.push('5678'), false);
+assert.equal(readCalls, 0);
+assert.equal(readable5.read().toString(), '12345678');
+assert.equal(readCalls, 1);
+
+// Piping pauses the source until the destination drains.
+var Writable = require('stream').Writable;
+var readable6 = new Readable();
+var writable6 = new Writable({ highWaterMark: 4 });
+var pending6 = [];
+var received6 = '';
+
+writable6._write = function(chunk, callback, onwrite) {
+  received6 += chunk.toString();
+  pending6.push(onwrite);
+};
+writable6._readyToWrite();
+
+readable6.pipe(writable6);
+readable6.push('abcd');
+assert.equal(readable6.isPaused(), true);
+readable6.push('efgh');
+assert.equal(received6, 'abcd');
+pending6.shift()();
+assert.equal(readable6.isPaused(), true);
+assert.equal(received6, 'abcdefgh');
+pending6.shift()();
+assert.equal(readable6.isPaused(), false);
+
 
 process.on('exit', function() {
   assert.equal(readable2 instanceof Readable, true);
@@ -0,0 +1,103 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+var Writable = require('stream').Writable;
+var assert = require('assert');
+
+
+// Corked writes are flushed with a single `_writev` call.
+var writable1 = new Writable();
+var written1 = [];
+var writev1 = 0;
+var callbacks1 = 0;
+var finished1 = false;
+
+writable1._write = function(chunk, callback, onwrite) {
+  written1.push(chunk.toString());
+  onwrite();
+  if (callback) {
+    callback();
+  }
+};
+
+writable1._writev = function(reqs, onwrite) {
+  writev1++;
+  for (var i = 0; i < reqs.length; ++i) {
+    written1.push(reqs[i].chunk.toString());
+  }
+  onwrite();
+  for (var i = 0; i < reqs.length; ++i) {
+    if (reqs[i].callback) {
+      reqs[i].callback();
+    }
+  }
+};
+
+writable1.on('finish', function() {
+  finished1 = true;
+});
+
+writable1._readyToWrite();
+
+writable1.cork();
+writable1.cork();
+writable1.write('a', function() { callbacks1++; });
+writable1.write('b', function() { callbacks1++; });
+writable1.uncork();
+assert.deepEqual(written1, []);
+writable1.write('c', function() { callbacks1++; });
+writable1.uncork();
+assert.equal(writev1, 1);
+assert.deepEqual(written1, ['a', 'b', 'c']);
+assert.equal(callbacks1, 3);
+
+// A single buffered chunk goes through `_write`.
+writable1.cork();
+writable1.write('d');
+writable1.uncork();
+assert.equal(writev1, 1);
+assert.deepEqual(written1, ['a', 'b', 'c', 'd']);
+
+// `end()` flushes the corked data.
+writable1.cork();
+writable1.write('e');
+writable1.end('f');
+assert.equal(writev1, 2);
+assert.deepEqual(written1, ['a', 'b', 'c', 'd', 'e', 'f']);
+
+
+// Without `_writev` the corked chunks are written one by one.
+var writable2 = new Writable();
+var written2 = [];
+
+writable2._write = function(chunk, callback, onwrite) {
+  written2.push(chunk.toString());
+  onwrite();
+};
+
+writable2._readyToWrite();
+
+writable2.cork();
+writable2.write('x');
+writable2.write('y');
+assert.deepEqual(written2, []);
+writable2.uncork();
+assert.deepEqual(written2, ['x', 'y']);
+
+
+process.on('exit', function() {
+  assert.equal(finished1, true);
+});
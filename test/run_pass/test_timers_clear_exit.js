@@ -0,0 +1,33 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var assert = require('assert');
+
+// A cleared timeout must not keep the process alive until its expiry.
+var start = Date.now();
+var fired = false;
+
+var timeout = setTimeout(function() {
+  fired = true;
+}, 10000);
+
+setTimeout(function() {
+  clearTimeout(timeout);
+}, 10);
+
+process.on('exit', function() {
+  assert(!fired);
+  assert(Date.now() - start < 5000);
+});
@@ -0,0 +1,71 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+var assert = require('assert');
+
+
+var trace = '';
+
+// Next ticks run before immediates, and after every immediate.
+setImmediate(function(a, b) {
+  assert.equal(a, 1);
+  assert.equal(b, 'two');
+  trace += 'I';
+  process.nextTick(function() {
+    trace += 't';
+  });
+}, 1, 'two');
+
+setImmediate(function() {
+  trace += 'J';
+
+  // Queued by an immediate, runs on the next iteration.
+  setImmediate(function() {
+    trace += 'K';
+  });
+});
+
+process.nextTick(function(a, b, c, d) {
+  assert.equal(a + b + c + d, 10);
+  trace += 'T';
+}, 1, 2, 3, 4);
+
+
+// Cleared immediates never run.
+var cleared = setImmediate(function() {
+  assert.fail();
+});
+clearImmediate(cleared);
+
+setImmediate(function() {
+  // Clearing an immediate that already ran is a no-op.
+  clearImmediate(cleared);
+  clearImmediate(null);
+});
+
+
+assert.throws(function() {
+  setImmediate();
+}, TypeError);
+
+assert.throws(function() {
+  process.nextTick('callback');
+}, TypeError);
+
+
+process.on('exit', function() {
+  assert.equal(trace, 'TItJK');
+});
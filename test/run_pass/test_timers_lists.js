@@ -0,0 +1,73 @@
+/* Copyright 2018-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+var assert = require('assert');
+
+
+// Timeouts fire in expiry order, regardless of the order they are started.
+var sequence = '';
+
+setTimeout(function() { sequence += 'C'; }, 300);
+setTimeout(function() { sequence += 'A'; }, 100);
+setTimeout(function() { sequence += 'B'; }, 200);
+setTimeout(function() { sequence += 'D'; }, 300);
+
+
+// Many timeouts with the same duration, half of them cleared.
+var fired = 0;
+var timeouts = [];
+
+for (var i = 0; i < 1000; i++) {
+  timeouts.push(setTimeout(function() { fired++; }, 50));
+}
+for (var i = 0; i < 1000; i += 2) {
+  clearTimeout(timeouts[i]);
+}
+
+
+// A refreshed timeout is postponed.
+var refreshed = false;
+var refreshTimeout = setTimeout(function() {
+  refreshed = true;
+}, 150);
+
+setTimeout(function() {
+  assert.equal(refreshed, false);
+  refreshTimeout.refresh();
+}, 100);
+
+setTimeout(function() {
+  assert.equal(refreshed, false);
+}, 200);
+
+
+// Immediates started from an immediate run on a later turn.
+var immediates = 0;
+
+setImmediate(function() {
+  immediates++;
+  setImmediate(function() {
+    immediates++;
+  });
+});
+
+
+process.on('exit', function() {
+  assert.equal(sequence, 'ABCD');
+  assert.equal(fired, 500);
+  assert.equal(refreshed, true);
+  assert.equal(immediates, 2);
+});
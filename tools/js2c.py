@@ -143,6 +143,24 @@ const iotjs_js_module_t js_modules[] = {{
 }};
 '''
 
+MODULE_HASH_H = '''
+/*
+ * Perfect hash of the module names: the module called `name` can only be
+ * js_modules[js_modules_hash[iotjs_module_hash(name, JS_MODULES_HASH_SEED) &
+ * JS_MODULES_HASH_MASK] - 1], zero entries mark unused slots.
+ */
+#define JS_MODULES_HASH_SEED {SEED}u
+#define JS_MODULES_HASH_MASK {MASK}u
+
+extern const uint16_t js_modules_hash[];
+'''
+
+MODULE_HASH_C = '''
+const uint16_t js_modules_hash[] = {{
+{ENTRIES}
+}};
+'''
+
 
 def hex_format(ch):
     if isinstance(ch, str):
@@ -162,6 +180,37 @@ def format_code(code, indent):
     return "\n".join(lines)
 
 
+def module_hash(name, seed):
+    """ FNV-1a hash of the module name, same as iotjs_module_hash(). """
+    value = (2166136261 ^ seed) & 0xffffffff
+    for ch in bytearray(name.encode('utf-8')):
+        value ^= ch
+        value = (value * 16777619) & 0xffffffff
+
+    return value
+
+
+def make_module_hash(names):
+    """ Find a seed which maps every name to a different slot of a table
+        with a power of two size, and return the seed and the table.
+    """
+    size = 1
+    while size < 2 * max(len(names), 1):
+        size *= 2
+
+    while True:
+        for seed in range(1 << 16):
+            table = [0] * size
+            for idx, name in enumerate(names):
+                slot = module_hash(name, seed) & (size - 1)
+                if table[slot]:
+                    break
+                table[slot] = idx + 1
+            else:
+                return seed, table
+        size *= 2
+
+
 def merge_snapshots(snapshot_infos, snapshot_tool):
     output_path = fs.join(path.SRC_ROOT, 'js','merged.modules')
     cmd = [snapshot_tool, "merge", "-o", output_path]
@@ -311,9 +360,10 @@ def js2c(options, js_modules):
                                                        NAME_UPPER=name.upper(),
                                                        SIZE=len(code),
                                                        CODE=code_string))
+            js_module_names = sorted(js_module_names)
             modules_struct = [
                '  {{ {0}_n, {0}_s, SIZE_{1} }},'.format(name, name.upper())
-               for name in sorted(js_module_names)
+               for name in js_module_names
             ]
             modules_struct.append('  { NULL, NULL, 0 }')
             native_struct_h = NATIVE_STRUCT_H
@@ -361,17 +411,27 @@ def js2c(options, js_modules):
                                                    NAME_UPPER=name.upper(),
                                                    SIZE=len(code),
                                                    CODE=code_string))
+            js_module_names = [info['name'] for info in snapshot_infos]
             modules_struct = [
-                '  {{ module_{0}, MODULE_{0}_IDX }},'.format(info['name'])
-                for info in snapshot_infos
+                '  {{ module_{0}, MODULE_{0}_IDX }},'.format(name)
+                for name in js_module_names
             ]
             modules_struct.append('  { NULL, 0 }')
             native_struct_h = NATIVE_SNAPSHOT_STRUCT_H
 
+        seed, hash_table = make_module_hash(js_module_names)
+        hash_entries = [
+            '  ' + ', '.join(str(entry) for entry in line)
+            for line in regroup(hash_table, 16)
+        ]
+
         fout_h.write(native_struct_h)
+        fout_h.write(MODULE_HASH_H.format(SEED=seed,
+                                          MASK=len(hash_table) - 1))
         fout_h.write(FOOTER1)
 
         fout_c.write(NATIVE_STRUCT_C.format(MODULES="\n".join(modules_struct)))
+        fout_c.write(MODULE_HASH_C.format(ENTRIES=",\n".join(hash_entries)))
         fout_c.write(EMPTY_LINE)
 
     # Write out the external magic strings